@@ -0,0 +1,181 @@
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "utils/memory/MatchArena.h"
+#include "GamePlay.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace {
+
+/// Counts every global allocation of the process. This file replaces the global operator new and is built as its own
+/// executable, CSxDArenaBench, so no other benchmark runs through the counting allocator.
+atomic<ull> global_allocations(0);
+
+const uint MATCH_ROUNDS = 30;
+
+vector<string> create_names(const string& prefix, size_t count) {
+    vector<string> names;
+    for (size_t i = 0; i < count; i++) {
+        names.push_back(prefix + to_string(i));
+    }
+    return names;
+}
+
+/// Plays a whole match: both teams join, then every round has knife taps, a scoreboard read and the round end
+void play_match(GamePlay& game_play, const vector<string>& terrorists, const vector<string>& counter_terrorists) {
+    size_t team_size = terrorists.size();
+    vector<PlayerHandle> terrorist_handles, counter_terrorist_handles;
+    for (size_t i = 0; i < team_size; i++) {
+        terrorist_handles.push_back(game_play.add_player(game_play.create_player(terrorists[i], TERRORIST)));
+        counter_terrorist_handles.push_back(game_play.add_player(game_play.create_player(counter_terrorists[i],
+                                                                                         COUNTER_TERRORIST)));
+    }
+
+    for (uint round = 0; round < MATCH_ROUNDS; round++) {
+        for (size_t i = 0; i < 4 * team_size; i++) {
+            game_play.try_attack_occurred(terrorist_handles[i % team_size],
+                                          counter_terrorist_handles[(i * 7) % team_size], MELEE);
+            game_play.try_attack_occurred(counter_terrorist_handles[(i * 3) % team_size],
+                                          terrorist_handles[(i * 5) % team_size], MELEE);
+        }
+        benchmark::DoNotOptimize(game_play.get_scoreboard_view(TERRORIST).size());
+        game_play.determine_winner_and_go_next_round();
+    }
+}
+
+unique_ptr<GamePlay> create_game_play(pmr::memory_resource* arena) {
+    return make_unique<GamePlay>(numeric_limits<uint>::max(), DENSE_PLAYER_ARRAYS,
+                                 arena != nullptr ? arena : pmr::get_default_resource());
+}
+
+/// Resident set size of the process in KiB
+long read_rss_kib() {
+    ifstream status("/proc/self/status");
+    string field;
+    long value = 0;
+    while (status >> field) {
+        if (field == "VmRSS:") {
+            status >> value;
+            break;
+        }
+    }
+    return value;
+}
+
+#ifdef __GLIBC__
+size_t heap_bytes_in_use() {
+    return mallinfo2().uordblks;
+}
+#endif
+
+}
+
+void* operator new(size_t size) {
+    global_allocations.fetch_add(1, memory_order_relaxed);
+    void* pointer = malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new(size_t size, align_val_t alignment) {
+    global_allocations.fetch_add(1, memory_order_relaxed);
+    auto alignment_size = static_cast<size_t>(alignment);
+    size_t aligned_size = size == 0 ? alignment_size : (size + alignment_size - 1) & ~(alignment_size - 1);
+    void* pointer = aligned_alloc(alignment_size, aligned_size);
+    if (pointer == nullptr) {
+        throw bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    free(pointer);
+}
+
+void operator delete(void* pointer, align_val_t) noexcept {
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t, align_val_t) noexcept {
+    free(pointer);
+}
+
+/// A match from the first join to its destruction, on the global heap (arena:0) or on a per-match monotonic arena
+/// (arena:1). Reports the global allocations per match.
+static void BM_PlayMatch(benchmark::State& state) {
+    Data::load();
+    bool use_arena = state.range(0);
+    auto terrorists = create_names("T", state.range(1));
+    auto counter_terrorists = create_names("CT", state.range(1));
+    ull allocations = 0;
+
+    for (auto _ : state) {
+        ull allocations_before = global_allocations.load(memory_order_relaxed);
+        {
+            MatchArena arena;
+            auto game_play = create_game_play(use_arena ? &arena : nullptr);
+            play_match(*game_play, terrorists, counter_terrorists);
+        }
+        allocations += global_allocations.load(memory_order_relaxed) - allocations_before;
+    }
+
+    state.counters["allocations"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_PlayMatch)->ArgNames({"arena", "team_size"})->ArgsProduct({{0, 1}, {5, 10}});
+
+/// Keeps many finished matches resident at once, as a host does, and reports the memory each one holds, with the heap
+/// bytes only where glibc reports them. The RSS growth depends on what earlier benchmarks left in the allocator's free
+/// lists, so run it with a filter to compare.
+static void BM_ResidentMatches(benchmark::State& state) {
+    Data::load();
+    bool use_arena = state.range(0);
+    size_t match_count = state.range(1);
+    auto terrorists = create_names("T", 10);
+    auto counter_terrorists = create_names("CT", 10);
+
+    for (auto _ : state) {
+        long rss_before = read_rss_kib();
+#ifdef __GLIBC__
+        size_t heap_before = heap_bytes_in_use();
+#endif
+        ull allocations_before = global_allocations.load(memory_order_relaxed);
+
+        vector<unique_ptr<MatchArena>> arenas;
+        vector<unique_ptr<GamePlay>> matches;
+        for (size_t i = 0; i < match_count; i++) {
+            arenas.push_back(use_arena ? make_unique<MatchArena>() : nullptr);
+            matches.push_back(create_game_play(arenas.back().get()));
+            play_match(*matches.back(), terrorists, counter_terrorists);
+        }
+
+        state.counters["allocations_per_match"] =
+                double(global_allocations.load(memory_order_relaxed) - allocations_before) / match_count;
+#ifdef __GLIBC__
+        state.counters["heap_bytes_per_match"] = double(heap_bytes_in_use() - heap_before) / match_count;
+#endif
+        state.counters["rss_kib"] = read_rss_kib() - rss_before;
+
+        state.PauseTiming();
+        matches.clear();
+        arenas.clear();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_ResidentMatches)->ArgNames({"arena", "matches"})->ArgsProduct({{0, 1}, {10000}})->Iterations(1);
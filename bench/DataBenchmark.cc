@@ -0,0 +1,44 @@
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+
+static void BM_LoadCompiledWeapons(benchmark::State& state) {
+    for (auto _ : state) {
+        Data::load();
+        benchmark::DoNotOptimize(Data::try_get_weapon_by_name("AK"));
+    }
+}
+BENCHMARK(BM_LoadCompiledWeapons);
+
+/// Runtime override path, reading and parsing weapons.json of the working directory
+static void BM_LoadWeaponsFile(benchmark::State& state) {
+    for (auto _ : state) {
+        Data::load("weapons.json");
+        benchmark::DoNotOptimize(Data::try_get_weapon_by_name("AK"));
+    }
+    Data::load();
+}
+BENCHMARK(BM_LoadWeaponsFile);
+
+static void BM_GetCompiledWeaponByName(benchmark::State& state) {
+    Data::load();
+    const string names[] = {"AK", "Knife", "UPS-S", "Glock-18"};
+    size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Data::try_get_weapon_by_name(names[i++ % 4]));
+    }
+}
+BENCHMARK(BM_GetCompiledWeaponByName);
+
+static void BM_GetLoadedWeaponByName(benchmark::State& state) {
+    Data::load("weapons.json");
+    const string names[] = {"AK", "Knife", "UPS-S", "Glock-18"};
+    size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Data::try_get_weapon_by_name(names[i++ % 4]));
+    }
+    Data::load();
+}
+BENCHMARK(BM_GetLoadedWeaponByName);
@@ -0,0 +1,99 @@
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "GamePlay.h"
+
+namespace {
+
+/// Game of practically unlimited rounds with two full teams of the given size, each player holding a knife
+shared_ptr<GamePlay> create_game_play(size_t team_size, vector<string>& terrorists,
+                                      vector<string>& counter_terrorists) {
+    Data::load();
+    auto game = make_shared<Game>(1, numeric_limits<uint>::max(), 135 * 1000, team_size);
+    auto game_play = make_shared<GamePlay>(game);
+
+    for (size_t i = 0; i < team_size; i++) {
+        terrorists.push_back("T" + to_string(i));
+        counter_terrorists.push_back("CT" + to_string(i));
+        game_play->add_player(game_play->create_player(terrorists.back(), TERRORIST));
+        game_play->add_player(game_play->create_player(counter_terrorists.back(), COUNTER_TERRORIST));
+    }
+
+    return game_play;
+}
+
+void apply_team_sizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Arg(5)->Arg(10)->Arg(100)->Arg(1000);
+}
+
+}
+
+static void BM_GetPlayerByName(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game = make_shared<Game>(1, 30, 135 * 1000, state.range(0));
+    for (size_t i = 0; i < (size_t) state.range(0); i++) {
+        terrorists.push_back("T" + to_string(i));
+        game->add_player(make_shared<Player>(terrorists.back(), 100, 10000, 1000, TERRORIST, 0));
+    }
+    size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game->get_player_by_name(terrorists[i++ % terrorists.size()]));
+    }
+}
+BENCHMARK(BM_GetPlayerByName)->Apply(apply_team_sizes);
+
+/// Knife taps across teams; every round end revives everyone, so the mix of hits and kills stays steady
+static void BM_AttackOccurred(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_game_play(state.range(0), terrorists, counter_terrorists);
+    size_t team_size = terrorists.size();
+    size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game_play->try_attack_occurred(terrorists[i % team_size],
+                                                                counter_terrorists[(i * 7) % team_size], MELEE));
+        if (++i % (4 * team_size) == 0) {
+            state.PauseTiming();
+            game_play->determine_winner_and_go_next_round();
+            state.ResumeTiming();
+        }
+    }
+}
+BENCHMARK(BM_AttackOccurred)->Apply(apply_team_sizes);
+
+/// Walks both scoreboards of a match with kills spread over the teams, as a SCORE-BOARD command prints them
+static void BM_GetScoreboard(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_game_play(state.range(0), terrorists, counter_terrorists);
+    size_t team_size = terrorists.size();
+    for (size_t i = 0; i < 4 * team_size; i++) {
+        game_play->try_attack_occurred(terrorists[i % team_size], counter_terrorists[(i * 7) % team_size], MELEE);
+        game_play->try_attack_occurred(counter_terrorists[(i * 3) % team_size], terrorists[(i * 5) % team_size], MELEE);
+    }
+
+    for (auto _ : state) {
+        uint kills = 0;
+        for (auto side : {COUNTER_TERRORIST, TERRORIST}) {
+            for (const auto& player : game_play->get_scoreboard_view(side)) {
+                kills += player->get_kills();
+            }
+        }
+        benchmark::DoNotOptimize(kills);
+    }
+}
+BENCHMARK(BM_GetScoreboard)->Apply(apply_team_sizes);
+
+static void BM_DetermineWinnerAndGoNextRound(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_game_play(state.range(0), terrorists, counter_terrorists);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game_play->determine_winner_and_go_next_round());
+    }
+}
+BENCHMARK(BM_DetermineWinnerAndGoNextRound)->Apply(apply_team_sizes);
@@ -0,0 +1,53 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "server/MatchIngress.h"
+
+namespace {
+
+const size_t INGRESS_CAPACITY = 4096;
+
+unique_ptr<BoundedMpscQueue<IngressCommand>> queue;
+atomic<bool> draining(false);
+thread consumer;
+
+}
+
+/// Every benchmark thread is a connection pushing pre-parsed commands into one match's queue, while a consumer thread
+/// drains it. The time per iteration is the enqueue latency, retries on a full queue included.
+static void BM_IngressEnqueue(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        queue = make_unique<BoundedMpscQueue<IngressCommand>>(INGRESS_CAPACITY);
+        draining = true;
+        consumer = thread([] {
+            IngressCommand command;
+            while (draining.load(memory_order_relaxed)) {
+                if (!queue->try_pop(command)) {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+    IngressCommand command {GET_MONEY, 1000, "Player" + to_string(state.thread_index()), "", "", TERRORIST, MELEE, false};
+    ull full_retries = 0;
+
+    for (auto _ : state) {
+        IngressCommand pushed = command;
+        while (!queue->try_push(pushed)) {
+            full_retries++;
+            this_thread::yield();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["full_retries"] = benchmark::Counter(full_retries, benchmark::Counter::kAvgIterations);
+    if (state.thread_index() == 0) {
+        draining = false;
+        consumer.join();
+        queue.reset();
+    }
+}
+BENCHMARK(BM_IngressEnqueue)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,74 @@
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "utils/generator/MatchGenerator.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+
+namespace {
+
+/// Plays a generated match end to end per iteration and reports commands per second. Commands are timed into
+/// latencies when they are given.
+void play_generated_match(benchmark::State& state, const MatchGeneratorOptions& options,
+                          CommandLatencies* latencies = nullptr) {
+    Data::load();
+    MatchGenerator generator(options);
+    string input = generator.generate();
+    ostringstream output;
+
+    for (auto _ : state) {
+        output.str("");
+        Interactions interactions;
+        interactions.set_input_buffer(input);
+        interactions.set_output_stream(output);
+        interactions.set_latencies(latencies);
+        interactions.init();
+        interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds()));
+        interactions.begin();
+        benchmark::DoNotOptimize(interactions.get_command_count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * generator.get_command_count());
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+MatchGeneratorOptions create_options(uint team_size, uint buy_weight, uint tap_weight, double invalid_ratio) {
+    MatchGeneratorOptions options;
+    options.rounds = 30;
+    options.team_size = team_size;
+    options.commands_per_round = 1000;
+    options.buy_weight = buy_weight;
+    options.tap_weight = tap_weight;
+    options.invalid_ratio = invalid_ratio;
+    return options;
+}
+
+}
+
+static void BM_InteractionsBegin(benchmark::State& state) {
+    play_generated_match(state, create_options(state.range(0), state.range(1), state.range(2),
+                                               state.range(3) / 100.0));
+}
+BENCHMARK(BM_InteractionsBegin)
+    ->ArgNames({"team_size", "buy_weight", "tap_weight", "invalid_percent"})
+    ->Args({5, 1, 4, 0})
+    ->Args({10, 1, 4, 0})
+    ->Args({10, 1, 16, 0})
+    ->Args({10, 4, 1, 0})
+    ->Args({10, 1, 4, 10})
+    ->Args({10, 1, 4, 50})
+    ->Unit(benchmark::kMillisecond);
+
+/// The default workload with command latencies recorded, to compare against its BM_InteractionsBegin counterpart
+static void BM_InteractionsLatencies(benchmark::State& state) {
+    CommandLatencies latencies(state.range(0));
+    play_generated_match(state, create_options(10, 1, 4, 0), &latencies);
+}
+BENCHMARK(BM_InteractionsLatencies)
+    ->ArgNames({"sample_period"})
+    ->Arg(1)
+    ->Arg(CommandLatencies::DEFAULT_SAMPLE_PERIOD)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,83 @@
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "utils/generator/MatchGenerator.h"
+#include "utils/journal/EventJournal.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+
+namespace {
+
+MatchGeneratorOptions create_journal_options() {
+    MatchGeneratorOptions options;
+    options.rounds = 30;
+    options.team_size = 10;
+    options.commands_per_round = 1000;
+    options.invalid_ratio = 0.05;
+    return options;
+}
+
+/// Plays the text match once, journaling it with a snapshot every rounds_per_snapshot rounds
+string play_match(const string& input, EventJournal* journal, uint rounds_per_snapshot) {
+    ostringstream output;
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output);
+    interactions.init();
+    auto game_play = make_shared<GamePlay>(interactions.get_rounds(), DENSE_PLAYER_ARRAYS);
+    game_play->set_journal(journal, rounds_per_snapshot);
+    interactions.set_game_play(game_play);
+    interactions.begin();
+    return output.str();
+}
+
+string journal_match(const string& input, uint rounds_per_snapshot) {
+    ostringstream journal_stream;
+    EventJournal journal(journal_stream);
+    play_match(input, &journal, rounds_per_snapshot);
+    return journal_stream.str();
+}
+
+}
+
+/// Rebuilding a match by executing its command log again, with parsing and validation
+static void BM_RecoverByCommandLog(benchmark::State& state) {
+    Data::load();
+    string input = MatchGenerator(create_journal_options()).generate();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(play_match(input, nullptr, 0));
+    }
+    state.counters["input_bytes"] = input.size();
+}
+BENCHMARK(BM_RecoverByCommandLog)->Unit(benchmark::kMicrosecond);
+
+/// Rebuilding the same match from its journal, with a snapshot every range(0) rounds (0 for none)
+static void BM_RecoverByJournal(benchmark::State& state) {
+    Data::load();
+    string journal = journal_match(MatchGenerator(create_journal_options()).generate(), state.range(0));
+
+    for (auto _ : state) {
+        GamePlay game_play(30, DENSE_PLAYER_ARRAYS);
+        game_play.recover(journal);
+        benchmark::DoNotOptimize(game_play.has_ended());
+    }
+    state.counters["journal_bytes"] = journal.size();
+}
+BENCHMARK(BM_RecoverByJournal)->Arg(0)->Arg(10)->Unit(benchmark::kMicrosecond);
+
+static void BM_PlayJournaledMatch(benchmark::State& state) {
+    Data::load();
+    string input = MatchGenerator(create_journal_options()).generate();
+    ostringstream journal_stream;
+
+    for (auto _ : state) {
+        journal_stream.str("");
+        EventJournal journal(journal_stream);
+        benchmark::DoNotOptimize(play_match(input, &journal, 10));
+    }
+}
+BENCHMARK(BM_PlayJournaledMatch)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,66 @@
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "GamePlay.h"
+
+namespace {
+
+/// Two full teams where every player holds a knife and a pistol but no heavy weapon
+shared_ptr<GamePlay> create_armed_game_play(vector<string>& terrorists, vector<string>& counter_terrorists) {
+    Data::load();
+    auto game_play = make_shared<GamePlay>(30);
+
+    for (int i = 0; i < 10; i++) {
+        terrorists.push_back("T" + to_string(i));
+        counter_terrorists.push_back("CT" + to_string(i));
+        game_play->add_player(game_play->create_player(terrorists.back(), TERRORIST));
+        game_play->add_player(game_play->create_player(counter_terrorists.back(), COUNTER_TERRORIST));
+        game_play->buy_weapon(terrorists.back(), Data::get_weapon_by_name("Glock-18"));
+        game_play->buy_weapon(counter_terrorists.back(), Data::get_weapon_by_name("UPS-S"));
+    }
+
+    return game_play;
+}
+
+}
+
+/// Low-damage taps between living players, with the occasional kill dropping the attacked player's guns
+static void BM_TapHeavyRound(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_armed_game_play(terrorists, counter_terrorists);
+    WeaponType weapon_types[] = {PISTOL, MELEE, HEAVY, PISTOL};
+    size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(game_play->try_attack_occurred(terrorists[i % 10], counter_terrorists[(i * 3) % 10],
+                                                                weapon_types[i % 4]));
+        if (++i % 4096 == 0) {
+            game_play->determine_winner_and_go_next_round();
+            if (game_play->has_ended()) {
+                state.PauseTiming();
+                terrorists.clear();
+                counter_terrorists.clear();
+                game_play = create_armed_game_play(terrorists, counter_terrorists);
+                state.ResumeTiming();
+            }
+        }
+    }
+}
+BENCHMARK(BM_TapHeavyRound);
+
+static void BM_FindWeapon(benchmark::State& state) {
+    Data::load();
+    Player player("Player", 100, 10000, 10000, TERRORIST, 0);
+    player.equip_weapon(Data::get_weapon_by_name("Knife").get());
+    player.equip_weapon(Data::get_weapon_by_name("Glock-18").get());
+    WeaponType weapon_types[] = {MELEE, PISTOL, HEAVY};
+    size_t i = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(player.find_weapon(weapon_types[i++ % 3]));
+    }
+}
+BENCHMARK(BM_FindWeapon);
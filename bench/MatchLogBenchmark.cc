@@ -0,0 +1,78 @@
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "utils/generator/MatchGenerator.h"
+#include "utils/matchlog/MatchLogWriter.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+#include "MatchLogReplayer.h"
+
+namespace {
+
+MatchGeneratorOptions create_options() {
+    MatchGeneratorOptions options;
+    options.rounds = 30;
+    options.team_size = 10;
+    options.commands_per_round = 1000;
+    options.invalid_ratio = 0.05;
+    return options;
+}
+
+/// Plays the text match once while recording it, returning the binary log
+string record(const string& input) {
+    ostringstream output;
+    ostringstream log;
+    MatchLogWriter recorder(log);
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output);
+    interactions.set_recorder(&recorder);
+    interactions.init();
+    interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds(), DENSE_PLAYER_ARRAYS));
+    interactions.begin();
+    recorder.flush();
+    return log.str();
+}
+
+}
+
+static void BM_PlayTextMatch(benchmark::State& state) {
+    Data::load();
+    MatchGenerator generator(create_options());
+    string input = generator.generate();
+    ostringstream output;
+
+    for (auto _ : state) {
+        output.str("");
+        Interactions interactions;
+        interactions.set_input_buffer(input);
+        interactions.set_output_stream(output);
+        interactions.init();
+        interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds(), DENSE_PLAYER_ARRAYS));
+        interactions.begin();
+    }
+
+    state.SetItemsProcessed(state.iterations() * generator.get_command_count());
+    state.counters["input_bytes"] = input.size();
+}
+BENCHMARK(BM_PlayTextMatch)->Unit(benchmark::kMillisecond);
+
+static void BM_ReplayMatchLog(benchmark::State& state) {
+    Data::load();
+    MatchGenerator generator(create_options());
+    string log = record(generator.generate());
+    ostringstream output;
+
+    for (auto _ : state) {
+        output.str("");
+        MatchLogReplayer replayer(log, output);
+        replayer.replay();
+    }
+
+    state.SetItemsProcessed(state.iterations() * generator.get_command_count());
+    state.counters["input_bytes"] = log.size();
+}
+BENCHMARK(BM_ReplayMatchLog)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "GamePlay.h"
+
+namespace {
+
+/// Two full teams with knives only, so every tap is a valid melee hit across teams
+shared_ptr<GamePlay> create_tap_game_play(vector<string>& names, vector<PlayerHandle>& handles, uint rounds = 30) {
+    Data::load();
+    auto game_play = make_shared<GamePlay>(rounds);
+
+    for (int i = 0; i < 10; i++) {
+        for (auto side : {TERRORIST, COUNTER_TERRORIST}) {
+            names.push_back((side == TERRORIST ? "Terrorist-" : "Counter-Terrorist-") + to_string(i));
+            handles.push_back(game_play->add_player(game_play->create_player(names.back(), side)));
+        }
+    }
+
+    return game_play;
+}
+
+}
+
+static void BM_AttackOccurredByName(benchmark::State& state) {
+    vector<string> names;
+    vector<PlayerHandle> handles;
+    auto game_play = create_tap_game_play(names, handles);
+    size_t i = 0;
+
+    for (auto _ : state) {
+        size_t attacker = (i * 2) % names.size();
+        benchmark::DoNotOptimize(game_play->try_attack_occurred(names[attacker], names[(attacker + 3) % names.size()],
+                                                                MELEE));
+        benchmark::DoNotOptimize(game_play->get_hp(names[attacker]));
+        i++;
+    }
+}
+BENCHMARK(BM_AttackOccurredByName);
+
+static void BM_AttackOccurredByHandle(benchmark::State& state) {
+    vector<string> names;
+    vector<PlayerHandle> handles;
+    auto game_play = create_tap_game_play(names, handles);
+    size_t i = 0;
+
+    for (auto _ : state) {
+        size_t attacker = (i * 2) % handles.size();
+        benchmark::DoNotOptimize(game_play->try_attack_occurred(handles[attacker],
+                                                                handles[(attacker + 3) % handles.size()], MELEE));
+        benchmark::DoNotOptimize(game_play->get_hp(handles[attacker]));
+        i++;
+    }
+}
+BENCHMARK(BM_AttackOccurredByHandle);
+
+namespace {
+
+/// Each burst starts a new round, so its first hits kill and the rest are rejected like late hits of a real burst. Only
+/// the burst is timed, manually, since pausing the timer around the round reset costs more than a short burst.
+vector<AttackEvent> create_tap_burst(const vector<PlayerHandle>& handles, size_t size) {
+    vector<AttackEvent> events;
+    for (size_t i = 0; i < size; i++) {
+        size_t attacker = (i * 2) % handles.size();
+        events.push_back({handles[attacker], handles[(attacker + 3) % handles.size()], MELEE});
+    }
+    return events;
+}
+
+}
+
+static void BM_AttackBurstOneByOne(benchmark::State& state) {
+    vector<string> names;
+    vector<PlayerHandle> handles;
+    auto game_play = create_tap_game_play(names, handles, numeric_limits<uint>::max());
+    auto events = create_tap_burst(handles, state.range(0));
+
+    for (auto _ : state) {
+        auto started_at = chrono::steady_clock::now();
+        for (const auto& event : events) {
+            benchmark::DoNotOptimize(game_play->try_attack_occurred(event.attacker, event.attacked, event.weapon_type));
+        }
+        state.SetIterationTime(chrono::duration<double>(chrono::steady_clock::now() - started_at).count());
+        game_play->determine_winner_and_go_next_round();
+    }
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(BM_AttackBurstOneByOne)->Arg(8)->Arg(64)->Arg(512)->UseManualTime();
+
+static void BM_AttackBurstBatched(benchmark::State& state) {
+    vector<string> names;
+    vector<PlayerHandle> handles;
+    auto game_play = create_tap_game_play(names, handles, numeric_limits<uint>::max());
+    auto events = create_tap_burst(handles, state.range(0));
+    vector<ActionResult> results(events.size());
+
+    for (auto _ : state) {
+        auto started_at = chrono::steady_clock::now();
+        game_play->try_attacks_occurred(events.data(), events.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+        state.SetIterationTime(chrono::duration<double>(chrono::steady_clock::now() - started_at).count());
+        game_play->determine_winner_and_go_next_round();
+    }
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(BM_AttackBurstBatched)->Arg(8)->Arg(64)->Arg(512)->UseManualTime();
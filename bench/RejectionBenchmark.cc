@@ -0,0 +1,109 @@
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "GamePlay.h"
+
+namespace {
+
+/// Two full teams where every odd terrorist is dead and nobody holds a pistol, so every pistol tap is rejected for a
+/// dead attacker, friendly fire or a missing weapon, and every AWP buy for lack of money
+shared_ptr<GamePlay> create_rejection_game_play(vector<string>& terrorists, vector<string>& counter_terrorists) {
+    Data::load();
+    auto game_play = make_shared<GamePlay>(30);
+
+    for (int i = 0; i < 10; i++) {
+        terrorists.push_back("T" + to_string(i));
+        counter_terrorists.push_back("CT" + to_string(i));
+        game_play->add_player(game_play->create_player(terrorists.back(), TERRORIST));
+        game_play->add_player(game_play->create_player(counter_terrorists.back(), COUNTER_TERRORIST));
+    }
+    for (int i = 1; i < 10; i += 2) {
+        game_play->attack_occurred(counter_terrorists[0], terrorists[i], MELEE);
+        game_play->attack_occurred(counter_terrorists[0], terrorists[i], MELEE);
+        game_play->attack_occurred(counter_terrorists[0], terrorists[i], MELEE);
+    }
+
+    return game_play;
+}
+
+const string& pick_attacked(size_t i, const vector<string>& terrorists, const vector<string>& counter_terrorists) {
+    return i % 4 == 0 ? terrorists[(i + 2) % 10] : counter_terrorists[9];
+}
+
+}
+
+static void BM_AttackOccurredThrowing(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_rejection_game_play(terrorists, counter_terrorists);
+    size_t i = 0;
+    uint rejected = 0;
+
+    for (auto _ : state) {
+        try {
+            game_play->attack_occurred(terrorists[i % 10], pick_attacked(i, terrorists, counter_terrorists), PISTOL);
+        }
+        catch (...) {
+            rejected++;
+        }
+        i++;
+    }
+    benchmark::DoNotOptimize(rejected);
+}
+BENCHMARK(BM_AttackOccurredThrowing);
+
+static void BM_AttackOccurredResult(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_rejection_game_play(terrorists, counter_terrorists);
+    size_t i = 0;
+    uint rejected = 0;
+
+    for (auto _ : state) {
+        if (game_play->try_attack_occurred(terrorists[i % 10], pick_attacked(i, terrorists, counter_terrorists),
+                                           PISTOL) != SUCCESS) {
+            rejected++;
+        }
+        i++;
+    }
+    benchmark::DoNotOptimize(rejected);
+}
+BENCHMARK(BM_AttackOccurredResult);
+
+static void BM_BuyWeaponThrowing(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_rejection_game_play(terrorists, counter_terrorists);
+    auto weapon = Data::get_weapon_by_name("AWP");
+    size_t i = 0;
+    uint rejected = 0;
+
+    for (auto _ : state) {
+        try {
+            game_play->buy_weapon(terrorists[i % 10], weapon);
+        }
+        catch (...) {
+            rejected++;
+        }
+        i++;
+    }
+    benchmark::DoNotOptimize(rejected);
+}
+BENCHMARK(BM_BuyWeaponThrowing);
+
+static void BM_BuyWeaponResult(benchmark::State& state) {
+    vector<string> terrorists, counter_terrorists;
+    auto game_play = create_rejection_game_play(terrorists, counter_terrorists);
+    auto weapon = Data::get_weapon_by_name("AWP");
+    size_t i = 0;
+    uint rejected = 0;
+
+    for (auto _ : state) {
+        if (game_play->try_buy_weapon(terrorists[i % 10], weapon) != SUCCESS) {
+            rejected++;
+        }
+        i++;
+    }
+    benchmark::DoNotOptimize(rejected);
+}
+BENCHMARK(BM_BuyWeaponResult);
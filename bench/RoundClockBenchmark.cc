@@ -0,0 +1,44 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "server/RoundClock.h"
+
+/// One thread driving many live matches, advancing the clock a millisecond at a time as a server loop would. Match
+/// starts are spread over a round, so phase changes are spread over the ticks too.
+static void BM_RoundClockAdvance(benchmark::State& state) {
+    Data::load();
+    size_t match_count = state.range(0);
+    RoundClock clock(0);
+    vector<unique_ptr<GamePlay>> game_plays;
+    for (size_t i = 0; i < match_count; i++) {
+        clock.advance(i * 135 * 1000 / match_count);
+        game_plays.push_back(make_unique<GamePlay>(numeric_limits<uint>::max()));
+        clock.add_match(game_plays.back().get());
+    }
+    ull time = clock.get_time();
+    size_t phases = 0;
+
+    for (auto _ : state) {
+        phases += clock.advance(++time);
+    }
+
+    state.counters["phases"] = benchmark::Counter(phases, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_RoundClockAdvance)->Arg(100)->Arg(1000)->Arg(10000);
+
+/// Scheduling and cancelling a timer a minute ahead on a wheel already holding many timers
+static void BM_TimerWheelScheduleCancel(benchmark::State& state) {
+    TimerWheel wheel(0);
+    for (ull i = 0; i < (ull) state.range(0); i++) {
+        wheel.schedule(i % (135 * 1000), i);
+    }
+
+    for (auto _ : state) {
+        wheel.cancel(wheel.schedule(60 * 1000, 0));
+    }
+}
+BENCHMARK(BM_TimerWheelScheduleCancel)->Arg(1000)->Arg(100000);
@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "models/game/Game.h"
+
+namespace {
+
+/// One full terrorist team where every iteration credits a kill or a death to one player and then reads the scoreboard
+struct ScoreboardWorkload {
+    explicit ScoreboardWorkload(size_t team_size) : game(1, 30, 135 * 1000, team_size), players(), next(0) {
+        for (size_t i = 0; i < team_size; i++) {
+            players.push_back(make_shared<Player>("T" + to_string(i), 100, 10000, 1000, TERRORIST, i));
+            game.add_player(players.back());
+        }
+    }
+
+    void change_score() {
+        auto& player = players[(next * 7919) % players.size()];
+        if (next % 3 == 0) {
+            player->take_damage(100);
+            player->reset_hp();
+        }
+        else {
+            player->add_kill();
+        }
+        next++;
+    }
+
+    Game game;
+    vector<shared_ptr<Player>> players;
+    size_t next;
+};
+
+}
+
+static void BM_ScoreboardSort(benchmark::State& state) {
+    ScoreboardWorkload workload(state.range(0));
+
+    for (auto _ : state) {
+        workload.change_score();
+        auto scoreboard = workload.game.get_all_players(TERRORIST);
+        sort(scoreboard.begin(), scoreboard.end(), Scoreboard::comparer);
+        benchmark::DoNotOptimize(scoreboard.front());
+    }
+}
+BENCHMARK(BM_ScoreboardSort)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_ScoreboardIndex(benchmark::State& state) {
+    ScoreboardWorkload workload(state.range(0));
+
+    for (auto _ : state) {
+        workload.change_score();
+        const auto& scoreboard = workload.game.get_scoreboard(TERRORIST);
+        benchmark::DoNotOptimize(scoreboard.front());
+    }
+}
+BENCHMARK(BM_ScoreboardIndex)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
@@ -0,0 +1,78 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "models/player/Player.h"
+#include "models/player/PlayerStore.h"
+
+namespace {
+
+/// Both sides of team_size players each, interleaved as they join
+PlayerStore create_store(size_t team_size) {
+    PlayerStore store;
+    store.reserve(team_size * 2);
+    for (size_t i = 0; i < team_size * 2; i++) {
+        store.add(i % 3 == 0 ? 0 : 60, 10000, (i * 37) % 10000, 0, 0, i % 2 == 0 ? COUNTER_TERRORIST : TERRORIST, i);
+    }
+    return store;
+}
+
+void settle_store(benchmark::State& state, SettlementKernel kernel) {
+    if (!is_settlement_kernel_supported(kernel)) {
+        state.SkipWithError("kernel is not supported by this CPU");
+        return;
+    }
+    PlayerStore store = create_store(state.range(0));
+
+    for (auto _ : state) {
+        store.reset_hp_and_add_money(COUNTER_TERRORIST, 3250, kernel);
+        store.reset_hp_and_add_money(TERRORIST, 1400, kernel);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+}
+
+/// Round-end settlement of both teams as Game does without dense arrays: reset_hp and add_money per player object
+static void BM_SettlementPlayers(benchmark::State& state) {
+    size_t team_size = state.range(0);
+    vector<unique_ptr<Player>> teams[2];
+    for (size_t i = 0; i < team_size * 2; i++) {
+        Side side = i % 2 == 0 ? COUNTER_TERRORIST : TERRORIST;
+        teams[i % 2].push_back(make_unique<Player>("Player" + to_string(i), i % 3 == 0 ? 0 : 60, 10000,
+                                                   (i * 37) % 10000, side, i));
+    }
+
+    for (auto _ : state) {
+        for (const auto& player : teams[0]) {
+            player->reset_hp();
+            player->add_money(3250);
+        }
+        for (const auto& player : teams[1]) {
+            player->reset_hp();
+            player->add_money(1400);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * team_size * 2);
+}
+BENCHMARK(BM_SettlementPlayers)->ArgName("team_size")->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_SettlementScalar(benchmark::State& state) {
+    settle_store(state, SCALAR_KERNEL);
+}
+BENCHMARK(BM_SettlementScalar)->ArgName("team_size")->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_SettlementSse41(benchmark::State& state) {
+    settle_store(state, SSE41_KERNEL);
+}
+BENCHMARK(BM_SettlementSse41)->ArgName("team_size")->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_SettlementAvx2(benchmark::State& state) {
+    settle_store(state, AVX2_KERNEL);
+}
+BENCHMARK(BM_SettlementAvx2)->ArgName("team_size")->RangeMultiplier(10)->Range(10, 10000);
@@ -0,0 +1,56 @@
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "utils/data/Data.h"
+#include "GamePlay.h"
+
+namespace {
+
+/// A 20 player match at a late round boundary, every player armed and with some kills and deaths
+shared_ptr<GamePlay> create_snapshot_game_play() {
+    Data::load();
+    auto game_play = make_shared<GamePlay>(30, DENSE_PLAYER_ARRAYS);
+
+    for (int i = 0; i < 10; i++) {
+        game_play->add_player(game_play->create_player("Terrorist-" + to_string(i), TERRORIST));
+        game_play->add_player(game_play->create_player("Counter-Terrorist-" + to_string(i), COUNTER_TERRORIST));
+    }
+    for (PlayerHandle i = 0; i < 20; i += 2) {
+        game_play->buy_weapon(i, Data::get_weapon_by_name("Glock-18"));
+        game_play->buy_weapon(i + 1, Data::get_weapon_by_name("Desert-Eagle"));
+    }
+    for (int round = 0; round < 27; round++) {
+        game_play->try_attack_occurred(round % 20, (round + 3) % 20, MELEE);
+        game_play->try_attack_occurred(round % 20, (round + 3) % 20, PISTOL);
+        game_play->determine_winner_and_go_next_round();
+    }
+
+    return game_play;
+}
+
+}
+
+static void BM_TakeSnapshot(benchmark::State& state) {
+    auto game_play = create_snapshot_game_play();
+    string snapshot;
+
+    for (auto _ : state) {
+        game_play->take_snapshot(snapshot);
+        benchmark::DoNotOptimize(snapshot.data());
+    }
+    state.counters["bytes"] = snapshot.size();
+}
+BENCHMARK(BM_TakeSnapshot);
+
+static void BM_RestoreSnapshot(benchmark::State& state) {
+    auto game_play = create_snapshot_game_play();
+    string snapshot;
+    game_play->take_snapshot(snapshot);
+    GamePlay restored(1, DENSE_PLAYER_ARRAYS);
+
+    for (auto _ : state) {
+        restored.restore_snapshot(snapshot);
+    }
+}
+BENCHMARK(BM_RestoreSnapshot);
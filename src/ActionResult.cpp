@@ -0,0 +1,38 @@
+#include "ActionResult.h"
+#include "exceptions/ActionAtIllegalTimeException.h"
+#include "exceptions/ActionFromDeadPlayerException.h"
+#include "exceptions/AttackDeadPlayerException.h"
+#include "exceptions/FriendlyFireException.h"
+#include "exceptions/NotEnoughMoneyException.h"
+#include "exceptions/NullPointerException.h"
+#include "exceptions/PlayerNotFoundException.h"
+#include "exceptions/WeaponNotAvailableException.h"
+#include "exceptions/WeaponNotEquippedException.h"
+#include "exceptions/WeaponOfThisTypeAlreadyEquippedException.h"
+
+void throw_if_failed(ActionResult result) {
+    switch (result) {
+        case SUCCESS:
+            return;
+        case PLAYER_NOT_FOUND:
+            throw PlayerNotFoundException();
+        case ACTION_FROM_DEAD_PLAYER:
+            throw ActionFromDeadPlayerException();
+        case ACTION_AT_ILLEGAL_TIME:
+            throw ActionAtIllegalTimeException();
+        case ATTACK_DEAD_PLAYER:
+            throw AttackDeadPlayerException();
+        case FRIENDLY_FIRE:
+            throw FriendlyFireException();
+        case NOT_ENOUGH_MONEY:
+            throw NotEnoughMoneyException();
+        case WEAPON_NOT_FOUND:
+            throw NullPointerException("weapon");
+        case WEAPON_NOT_AVAILABLE:
+            throw WeaponNotAvailableException();
+        case WEAPON_NOT_EQUIPPED:
+            throw WeaponNotEquippedException();
+        case WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED:
+            throw WeaponOfThisTypeAlreadyEquippedException();
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef CSXD_ACTIONRESULT_H
+#define CSXD_ACTIONRESULT_H
+
+enum ActionResult {
+    SUCCESS,
+    PLAYER_NOT_FOUND,
+    ACTION_FROM_DEAD_PLAYER,
+    ACTION_AT_ILLEGAL_TIME,
+    ATTACK_DEAD_PLAYER,
+    FRIENDLY_FIRE,
+    NOT_ENOUGH_MONEY,
+    WEAPON_NOT_FOUND,
+    WEAPON_NOT_AVAILABLE,
+    WEAPON_NOT_EQUIPPED,
+    WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED
+};
+
+void throw_if_failed(ActionResult result);
+
+#endif //CSXD_ACTIONRESULT_H
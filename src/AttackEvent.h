@@ -0,0 +1,16 @@
+#ifndef CSXD_ATTACKEVENT_H
+#define CSXD_ATTACKEVENT_H
+
+
+#include "models/game/PlayerHandle.h"
+#include "models/weapon/WeaponType.h"
+
+/// One hit of a burst resolved by GamePlay::try_attacks_occurred
+struct AttackEvent {
+    PlayerHandle attacker;
+    PlayerHandle attacked;
+    WeaponType weapon_type;
+};
+
+
+#endif //CSXD_ATTACKEVENT_H
@@ -1,6 +1,10 @@
 #ifndef CSXD_COMMAND_H
 #define CSXD_COMMAND_H
 
+#include <string_view>
+
+using namespace std;
+
 enum Command {
     ADD_USER,
     GET_HEALTH,
@@ -10,4 +14,23 @@ enum Command {
     SCORE_BOARD
 };
 
+/// The command as it is written in match input
+inline string_view get_command_name(Command command) {
+    switch (command) {
+        case ADD_USER:
+            return "ADD-USER";
+        case GET_HEALTH:
+            return "GET-HEALTH";
+        case GET_MONEY:
+            return "GET-MONEY";
+        case BUY:
+            return "BUY";
+        case TAP:
+            return "TAP";
+        case SCORE_BOARD:
+            return "SCORE-BOARD";
+    }
+    return "";
+}
+
 #endif //CSXD_COMMAND_H
@@ -1,140 +1,291 @@
+#include <array>
 #include <utility>
 
 #include "GamePlay.h"
 #include "utils/data/Data.h"
-#include "exceptions/ActionAtIllegalTimeException.h"
-#include "exceptions/ActionFromDeadPlayerException.h"
-#include "exceptions/AttackDeadPlayerException.h"
-#include "exceptions/FriendlyFireException.h"
 #include "exceptions/LastRoundException.h"
 #include "exceptions/NullPointerException.h"
-#include "exceptions/WeaponNotAvailableException.h"
-#include "exceptions/WeaponNotEquippedException.h"
-#include "exceptions/WeaponOfThisTypeAlreadyEquippedException.h"
+#include "exceptions/WeaponNotFoundException.h"
+#include "utils/trace/Trace.h"
 
-GamePlay::GamePlay(shared_ptr<Game> for_game) {
+GamePlay::GamePlay(shared_ptr<Game> for_game) : catalog(Data::get_catalog()), catalog_changed(false), journal(nullptr), snapshot_interval(0), snapshot_buffer() {
     if (for_game == nullptr) {
         throw NullPointerException("for_game");
     }
 
     game = std::move(for_game);
+    // A game that already has players keeps the catalog they point into, until the next round boundary updates it
+    if (game->get_pinned_catalog() != nullptr) {
+        catalog = game->get_pinned_catalog();
+    }
+    game->pin_catalog(catalog);
 }
 
-GamePlay::GamePlay(uint rounds) {
-    game = make_shared<Game>(1, rounds, ROUND_LENGTH, MAX_TEAM_SIZE);
+GamePlay::GamePlay(uint rounds, PlayerStorage storage, pmr::memory_resource* memory) : catalog(Data::get_catalog()), catalog_changed(false), journal(nullptr), snapshot_interval(0), snapshot_buffer() {
+    game = make_shared<Game>(1, rounds, ROUND_LENGTH, MAX_TEAM_SIZE, storage, memory);
+    game->reserve(MAX_TEAM_SIZE);
+    game->pin_catalog(catalog);
 }
 
 void GamePlay::set_round_time(ull time) const {
     game->set_round_time(time);
 }
 
+ull GamePlay::get_round_length() const {
+    return game->get_round_length();
+}
+
+ull GamePlay::get_enter_time_limit() const {
+    return ENTER_TIME_LIMIT;
+}
+
+ull GamePlay::get_buy_time_limit() const {
+    return BUY_TIME_LIMIT;
+}
+
 shared_ptr<Player> GamePlay::create_player(const string& name, Side side) const {
-    auto player = make_shared<Player>(name, game->get_round_time() >= ENTER_TIME_LIMIT ? 0 : 100, PLAYER_MAX_MONEY,
-                                      PLAYER_INITIAL_MONEY, side, game->get_game_time());
+    auto player = game->allocate_player(name, game->get_round_time() >= ENTER_TIME_LIMIT ? 0 : 100, PLAYER_MAX_MONEY,
+                                        PLAYER_INITIAL_MONEY, side, game->get_game_time());
 
-    player->equip_weapon(Data::get_weapon_by_name("Knife"));
+    player->equip_weapon(get_weapon_by_name("Knife").get());
 
     return player;
 }
 
-void GamePlay::add_player(const shared_ptr<Player>& player) const {
-    game->add_player(player);
+shared_ptr<Weapon> GamePlay::get_weapon_by_name(const string& weapon_name) const {
+    auto weapon = try_get_weapon_by_name(weapon_name);
+    if (weapon == nullptr) {
+        throw WeaponNotFoundException();
+    }
+    return weapon;
+}
+
+/// Looks the weapon up in the catalog version this match is pinned to, without any locking
+shared_ptr<Weapon> GamePlay::try_get_weapon_by_name(const string& weapon_name) const {
+    return catalog->find(weapon_name);
+}
+
+ull GamePlay::get_catalog_version() const {
+    return catalog->get_version();
+}
+
+PlayerHandle GamePlay::add_player(const shared_ptr<Player>& player) const {
+    PlayerHandle handle = game->add_player(player);
+
+    if (journal != nullptr) {
+        journal->player_added(player->get_name(), player->get_side(), player->get_entry_time(), player->get_hp(),
+                              player->get_max_money(), player->get_money());
+        for (auto type : {MELEE, PISTOL, HEAVY}) {
+            auto weapon = player->find_weapon(type);
+            if (weapon != nullptr) {
+                journal->weapon_equipped(handle, weapon->get_name());
+            }
+        }
+    }
+
+    return handle;
+}
+
+PlayerHandle GamePlay::get_player_handle(const string& player_name) const {
+    return game->get_player_handle(player_name);
 }
 
 uint GamePlay::get_hp(const string& player_name) const {
     return game->get_player_by_name(player_name)->get_hp();
 }
 
+uint GamePlay::get_hp(PlayerHandle player) const {
+    return game->get_player_by_handle(player)->get_hp();
+}
+
 uint GamePlay::get_money(const string& player_name) const {
     return game->get_player_by_name(player_name)->get_money();
 }
 
+uint GamePlay::get_money(PlayerHandle player) const {
+    return game->get_player_by_handle(player)->get_money();
+}
+
 void GamePlay::buy_weapon(const string& player_name, const shared_ptr<Weapon>& weapon) const {
-    auto player = game->get_player_by_name(player_name);
+    throw_if_failed(try_buy_weapon(player_name, weapon));
+}
 
-    check_player_can_buy_weapon(player, weapon);
+void GamePlay::buy_weapon(PlayerHandle player, const shared_ptr<Weapon>& weapon) const {
+    throw_if_failed(try_buy_weapon(player, weapon));
+}
 
-    player->subtract_money(weapon->get_price());
-    player->equip_weapon(weapon);
+ActionResult GamePlay::try_buy_weapon(const string& player_name, const shared_ptr<Weapon>& weapon) const {
+    return try_buy_weapon_for(game->find_player_by_name(player_name), weapon);
 }
 
-void GamePlay::check_player_can_buy_weapon(const shared_ptr<Player>& player, const shared_ptr<Weapon>& weapon) const {
+ActionResult GamePlay::try_buy_weapon(PlayerHandle player, const shared_ptr<Weapon>& weapon) const {
+    return try_buy_weapon_for(game->find_player_by_handle(player), weapon);
+}
+
+ActionResult GamePlay::try_buy_weapon_for(const shared_ptr<Player>& player, const shared_ptr<Weapon>& weapon) const {
+    if (player == nullptr) {
+        return PLAYER_NOT_FOUND;
+    }
+
+    auto result = check_player_can_buy_weapon(player, weapon);
+    if (result != SUCCESS) {
+        return result;
+    }
+
+    CSXD_TRACE_SPAN("execute");
+
+    if (!player->try_subtract_money(weapon->get_price())) {
+        return NOT_ENOUGH_MONEY;
+    }
+    player->equip_weapon(weapon.get());
+
+    if (journal != nullptr) {
+        journal->money_changed(player->get_id(), player->get_money());
+        journal->weapon_equipped(player->get_id(), weapon->get_name());
+    }
+
+    return SUCCESS;
+}
+
+ActionResult GamePlay::check_player_can_buy_weapon(const shared_ptr<Player>& player,
+                                                   const shared_ptr<Weapon>& weapon) const {
+    CSXD_TRACE_SPAN("validate");
     if(!player->is_alive()) {
-        throw ActionFromDeadPlayerException();
+        return ACTION_FROM_DEAD_PLAYER;
     }
     if(game->get_round_time() >= BUY_TIME_LIMIT) {
-        throw ActionAtIllegalTimeException();
+        return ACTION_AT_ILLEGAL_TIME;
     }
     if (weapon == nullptr) {
-        throw NullPointerException("weapon");
+        return WEAPON_NOT_FOUND;
     }
     if (!weapon->is_available_for(player->get_side())) {
-        throw WeaponNotAvailableException();
+        return WEAPON_NOT_AVAILABLE;
     }
     if (is_weapon_already_equipped(player, weapon->get_type())) {
-        throw WeaponOfThisTypeAlreadyEquippedException();
+        return WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED;
     }
+    return SUCCESS;
 }
 
 bool GamePlay::is_weapon_already_equipped(const shared_ptr<Player>& player, WeaponType weapon_type) const {
-    try {
-        player->get_weapon(weapon_type);
-    }
-    catch (...) {
-        return false;
-    }
-    return true;
+    return player->find_weapon(weapon_type) != nullptr;
 }
 
 void GamePlay::attack_occurred(const string& attacker_name, const string& attacked_name, WeaponType weapon_type) const {
-    auto attacker = game->get_player_by_name(attacker_name);
-    auto attacked = game->get_player_by_name(attacked_name);
+    throw_if_failed(try_attack_occurred(attacker_name, attacked_name, weapon_type));
+}
+
+void GamePlay::attack_occurred(PlayerHandle attacker, PlayerHandle attacked, WeaponType weapon_type) const {
+    throw_if_failed(try_attack_occurred(attacker, attacked, weapon_type));
+}
+
+ActionResult GamePlay::try_attack_occurred(const string& attacker_name, const string& attacked_name,
+                                           WeaponType weapon_type) const {
+    return try_attack_between(game->find_player_by_name(attacker_name), game->find_player_by_name(attacked_name),
+                              weapon_type);
+}
+
+ActionResult GamePlay::try_attack_occurred(PlayerHandle attacker, PlayerHandle attacked, WeaponType weapon_type) const {
+    return try_attack_between(game->find_player_by_handle(attacker), game->find_player_by_handle(attacked),
+                              weapon_type);
+}
 
-    check_attack_could_have_occurred(attacker, attacked, weapon_type);
+/// Resolves a burst of hits in order, each exactly as try_attack_occurred would, so a hit from a player killed earlier
+/// in the burst is rejected and a kill goes to the first hit that brings hp to 0. Only the lookups are amortized: the
+/// player array is read once per burst and hits index it without copying a shared pointer. Every hit is still validated
+/// on its own, as each one can kill a player or drop weapons that later hits are checked against, and a TAP has no
+/// round or time checks that would hold for the whole burst.
+void GamePlay::try_attacks_occurred(const AttackEvent* events, size_t count, ActionResult* results) const {
+    const auto& players = game->get_players();
+    size_t player_count = players.size();
+    for (size_t i = 0; i < count; i++) {
+        const AttackEvent& event = events[i];
+        if (event.attacker >= player_count || event.attacked >= player_count) {
+            results[i] = PLAYER_NOT_FOUND;
+            continue;
+        }
+        results[i] = try_attack_between(players[event.attacker], players[event.attacked], event.weapon_type);
+    }
+}
 
-    auto weapon = attacker->get_weapon(weapon_type);
+ActionResult GamePlay::try_attack_between(const shared_ptr<Player>& attacker, const shared_ptr<Player>& attacked,
+                                          WeaponType weapon_type) const {
+    if (attacker == nullptr || attacked == nullptr) {
+        return PLAYER_NOT_FOUND;
+    }
+
+    auto result = check_attack_could_have_occurred(attacker, attacked, weapon_type);
+    if (result != SUCCESS) {
+        return result;
+    }
+
+    CSXD_TRACE_SPAN("execute");
+
+    auto weapon = attacker->find_weapon(weapon_type);
 
     attacked->take_damage(weapon->get_damage_per_hit());
+    if (journal != nullptr) {
+        journal->damage_taken(attacked->get_id(), weapon->get_damage_per_hit());
+    }
     if (!attacked->is_alive()) {
         attacked_died_in_attack(attacker, attacked, weapon);
     }
+
+    return SUCCESS;
 }
 
-void GamePlay::check_attack_could_have_occurred(const shared_ptr<Player>& attacker, const shared_ptr<Player>& attacked,
-                                                WeaponType weapon_type) const {
+ActionResult GamePlay::check_attack_could_have_occurred(const shared_ptr<Player>& attacker,
+                                                        const shared_ptr<Player>& attacked,
+                                                        WeaponType weapon_type) const {
+    CSXD_TRACE_SPAN("validate");
     if (!attacker->is_alive()) {
-        throw ActionFromDeadPlayerException();
+        return ACTION_FROM_DEAD_PLAYER;
     }
     if (!attacked->is_alive()) {
-        throw AttackDeadPlayerException();
+        return ATTACK_DEAD_PLAYER;
+    }
+    if (attacker->find_weapon(weapon_type) == nullptr) {
+        return WEAPON_NOT_EQUIPPED;
     }
-    /// Throws if weapon of this type is not equipped
-    attacker->get_weapon(weapon_type);
     if (attacker->get_side() == attacked->get_side()) {
-        throw FriendlyFireException();
+        return FRIENDLY_FIRE;
     }
+    return SUCCESS;
 }
 
 void GamePlay::attacked_died_in_attack(const shared_ptr<Player>& attacker, const shared_ptr<Player>& attacked,
-                                       const shared_ptr<Weapon>& weapon) const {
+                                       const Weapon* weapon) const {
     drop_weapon_if_equipped(attacked, PISTOL);
     drop_weapon_if_equipped(attacked, HEAVY);
 
     attacker->add_kill();
     attacker->add_money(weapon->get_money_per_kill());
+
+    if (journal != nullptr) {
+        journal->kill_added(attacker->get_id());
+        journal->money_changed(attacker->get_id(), attacker->get_money());
+    }
 }
 
 void GamePlay::drop_weapon_if_equipped(const shared_ptr<Player>& player, WeaponType weapon_type) const {
-    try {
-        player->drop_weapon(weapon_type);
-    }
-    catch (const WeaponNotEquippedException& ex) { }
-    catch (...) {
-        throw;
+    if (player->try_drop_weapon(weapon_type) && journal != nullptr) {
+        journal->weapon_dropped(player->get_id(), weapon_type);
     }
 }
 
 Side GamePlay::determine_winner_and_go_next_round() const {
+    CSXD_TRACE_SPAN("determine_winner_and_go_next_round");
+    Side winner_side = finish_round();
+
+    if (journal != nullptr) {
+        journal_round_ended(winner_side);
+    }
+
+    return winner_side;
+}
+
+Side GamePlay::finish_round() const {
     go_next_round_or_end();
 
     Side winner_side, loser_side;
@@ -143,9 +294,40 @@ Side GamePlay::determine_winner_and_go_next_round() const {
     reset_players_and_add_money(winner_side, WINNER_MONEY_PER_ROUND);
     reset_players_and_add_money(loser_side, LOSER_MONEY_PER_ROUND);
 
+    update_catalog();
+
     return winner_side;
 }
 
+/// Moves the match to the latest published catalog, at a round boundary so a round never mixes two versions.
+/// Equipped weapons are replaced by the weapons of the same name in the new catalog, or dropped if it has none. These
+/// changes are not journaled as events; the round end writes a snapshot instead, see journal_round_ended.
+void GamePlay::update_catalog() const {
+    if (catalog->get_version() == Data::get_catalog_version()) {
+        return;
+    }
+
+    auto latest_catalog = Data::get_catalog();
+    for (const auto& player : game->get_all_players(ALL)) {
+        array<const Weapon*, 3> equipped_weapons = {player->find_weapon(MELEE), player->find_weapon(PISTOL),
+                                                    player->find_weapon(HEAVY)};
+        for (auto weapon : equipped_weapons) {
+            if (weapon != nullptr) {
+                player->try_drop_weapon(weapon->get_type());
+            }
+        }
+        for (auto weapon : equipped_weapons) {
+            auto latest_weapon = weapon == nullptr ? nullptr : latest_catalog->find(weapon->get_name());
+            if (latest_weapon != nullptr) {
+                player->equip_weapon(latest_weapon.get());
+            }
+        }
+    }
+    catalog = latest_catalog;
+    game->pin_catalog(catalog);
+    catalog_changed = true;
+}
+
 void GamePlay::go_next_round_or_end() const {
     try {
         game->go_next_round();
@@ -170,13 +352,11 @@ void GamePlay::find_winner_loser(Side& winner_side, Side& loser_side) const {
 }
 
 void GamePlay::reset_players_and_add_money(Side side, uint money) const {
-    for (const auto& player : game->get_all_players(side)) {
-        player->reset_hp();
-        player->add_money(money);
-    }
+    game->reset_players_and_add_money(side, money);
 }
 
 vector<shared_ptr<Player>> GamePlay::get_scoreboard(Side side) const {
+    CSXD_TRACE_SPAN("get_scoreboard");
     auto players = game->get_all_players(side);
 
     sort(players.begin(), players.end(), scoreboard_comparer);
@@ -184,16 +364,119 @@ vector<shared_ptr<Player>> GamePlay::get_scoreboard(Side side) const {
     return players;
 }
 
+/// Scoreboard of a single side as maintained by the game, without sorting or copying
+const pmr::vector<shared_ptr<Player>>& GamePlay::get_scoreboard_view(Side side) const {
+    return game->get_scoreboard(side);
+}
+
 bool GamePlay::scoreboard_comparer(const shared_ptr<Player>& p1, const shared_ptr<Player>& p2) {
-    if(p1->get_kills() != p2->get_kills()) {
-        return p1->get_kills() > p2->get_kills();
-    }
-    if(p1->get_deaths() != p2->get_deaths()) {
-        return p1->get_deaths() < p2->get_deaths();
-    }
-    return p1->get_entry_time() < p2->get_entry_time();
+    return Scoreboard::comparer(p1, p2);
 }
 
 bool GamePlay::has_ended() const {
     return game->has_ended();
 }
+
+/// Cheap enough to take at every round boundary, see Game::take_snapshot
+void GamePlay::take_snapshot(string& snapshot) const {
+    game->take_snapshot(snapshot);
+}
+
+void GamePlay::restore_snapshot(string_view snapshot) const {
+    game->restore_snapshot(snapshot, catalog);
+}
+
+/// Events of every state change are written to the journal and committed once per round. With rounds_per_snapshot,
+/// a snapshot is also written every that many rounds, so recovery only applies the events after it.
+void GamePlay::set_journal(EventJournal* event_journal, uint rounds_per_snapshot) {
+    journal = event_journal;
+    snapshot_interval = rounds_per_snapshot;
+}
+
+/// Group commit of the round, together with a snapshot when one is due. A snapshot is also due after a catalog change,
+/// whose loadouts depend on the catalogs published at the time, so recovery never replays events from before it.
+void GamePlay::journal_round_ended(Side winner_side) const {
+    journal->round_ended(winner_side);
+
+    uint finished_rounds = game->get_current_round() - 1 + game->has_ended();
+    if (catalog_changed || (snapshot_interval > 0 && finished_rounds % snapshot_interval == 0)) {
+        game->take_snapshot(snapshot_buffer);
+        journal->snapshot(snapshot_buffer);
+        catalog_changed = false;
+    }
+    else {
+        journal->commit();
+    }
+}
+
+/// Rebuilds the game from the last snapshot of the journal and the events committed after it. Without a snapshot, the
+/// game should be as new as the one that wrote the journal.
+void GamePlay::recover(string_view journal_contents) const {
+    EventJournalReader reader(journal_contents);
+    vector<JournalFrame> frames;
+    size_t first_frame = 0;
+    JournalFrame frame;
+    while (reader.next(frame)) {
+        if (frame.type == SNAPSHOT_FRAME) {
+            first_frame = frames.size();
+        }
+        frames.push_back(frame);
+    }
+
+    if (first_frame < frames.size() && frames[first_frame].type == SNAPSHOT_FRAME) {
+        game->restore_snapshot(frames[first_frame].payload, catalog);
+        first_frame++;
+    }
+
+    JournalEvent event;
+    for (size_t i = first_frame; i < frames.size(); i++) {
+        size_t position = 0;
+        while (EventJournalReader::next_event(frames[i].payload, position, event)) {
+            apply_journal_event(event);
+        }
+    }
+}
+
+/// Events were validated when they were journaled, so they are applied to the game directly
+void GamePlay::apply_journal_event(const JournalEvent& event) const {
+    switch (event.type) {
+        case PLAYER_ADDED: {
+            game->add_player(game->allocate_player(string(event.name), event.value, event.max_money, event.money,
+                                                   event.side, event.entry_time));
+            break;
+        }
+        case MONEY_CHANGED: {
+            auto player = game->get_player_by_handle(event.player);
+            uint money = player->get_money();
+            if (event.value >= money) {
+                player->add_money(event.value - money);
+            }
+            else {
+                player->subtract_money(money - event.value);
+            }
+            break;
+        }
+        case DAMAGE_TAKEN: {
+            game->get_player_by_handle(event.player)->take_damage(event.value);
+            break;
+        }
+        case KILL_ADDED: {
+            game->get_player_by_handle(event.player)->add_kill();
+            break;
+        }
+        case WEAPON_EQUIPPED: {
+            game->get_player_by_handle(event.player)->equip_weapon(get_weapon_by_name(string(event.name)).get());
+            break;
+        }
+        case WEAPON_DROPPED: {
+            game->get_player_by_handle(event.player)->drop_weapon(event.weapon_type);
+            break;
+        }
+        case ROUND_ENDED: {
+            if (finish_round() != event.side) {
+                throw invalid_argument("journal does not match the game it is applied to");
+            }
+            break;
+        }
+    }
+}
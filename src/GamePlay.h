@@ -3,12 +3,19 @@
 
 
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <algorithm>
 
 #include "models/weapon/WeaponType.h"
 #include "models/player/Side.h"
 #include "models/game/Game.h"
+#include "utils/data/WeaponCatalog.h"
+#include "utils/journal/EventJournal.h"
+#include "utils/journal/EventJournalReader.h"
+#include "ActionResult.h"
+#include "AttackEvent.h"
+#include "Mockable.h"
 
 using namespace std;
 
@@ -17,31 +24,64 @@ typedef unsigned long long ull;
 class GamePlay {
 public:
     explicit GamePlay(shared_ptr<Game> for_game);
-    explicit GamePlay(uint rounds);
+    explicit GamePlay(uint rounds, PlayerStorage storage = PLAYER_OBJECTS,
+                      pmr::memory_resource* memory = pmr::get_default_resource());
     virtual ~GamePlay() = default;
 
-    virtual void set_round_time(ull time) const;
-    virtual shared_ptr<Player> create_player(const string& name, Side side) const;
-    virtual void add_player(const shared_ptr<Player>& player) const;
-    virtual uint get_hp(const string& player_name) const;
-    virtual uint get_money(const string& player_name) const;
-    virtual void buy_weapon(const string& player_name, const shared_ptr<Weapon>& weapon) const;
-    virtual void attack_occurred(const string& attacker_name, const string& attacked_name, WeaponType weapon_type) const;
-    virtual Side determine_winner_and_go_next_round() const;
-    virtual vector<shared_ptr<Player>> get_scoreboard(Side side) const;
-    virtual bool has_ended() const;
+    CSXD_VIRTUAL void set_round_time(ull time) const;
+    ull get_round_length() const;
+    ull get_enter_time_limit() const;
+    ull get_buy_time_limit() const;
+    CSXD_VIRTUAL shared_ptr<Player> create_player(const string& name, Side side) const;
+    CSXD_VIRTUAL shared_ptr<Weapon> get_weapon_by_name(const string& weapon_name) const;
+    CSXD_VIRTUAL shared_ptr<Weapon> try_get_weapon_by_name(const string& weapon_name) const;
+    ull get_catalog_version() const;
+    CSXD_VIRTUAL PlayerHandle add_player(const shared_ptr<Player>& player) const;
+    CSXD_VIRTUAL PlayerHandle get_player_handle(const string& player_name) const;
+    CSXD_VIRTUAL uint get_hp(const string& player_name) const;
+    CSXD_VIRTUAL uint get_hp(PlayerHandle player) const;
+    CSXD_VIRTUAL uint get_money(const string& player_name) const;
+    CSXD_VIRTUAL uint get_money(PlayerHandle player) const;
+    CSXD_VIRTUAL void buy_weapon(const string& player_name, const shared_ptr<Weapon>& weapon) const;
+    CSXD_VIRTUAL void buy_weapon(PlayerHandle player, const shared_ptr<Weapon>& weapon) const;
+    CSXD_VIRTUAL ActionResult try_buy_weapon(const string& player_name, const shared_ptr<Weapon>& weapon) const;
+    CSXD_VIRTUAL ActionResult try_buy_weapon(PlayerHandle player, const shared_ptr<Weapon>& weapon) const;
+    CSXD_VIRTUAL void attack_occurred(const string& attacker_name, const string& attacked_name, WeaponType weapon_type) const;
+    CSXD_VIRTUAL void attack_occurred(PlayerHandle attacker, PlayerHandle attacked, WeaponType weapon_type) const;
+    CSXD_VIRTUAL ActionResult try_attack_occurred(const string& attacker_name, const string& attacked_name,
+                                             WeaponType weapon_type) const;
+    CSXD_VIRTUAL ActionResult try_attack_occurred(PlayerHandle attacker, PlayerHandle attacked,
+                                             WeaponType weapon_type) const;
+    CSXD_VIRTUAL void try_attacks_occurred(const AttackEvent* events, size_t count, ActionResult* results) const;
+    CSXD_VIRTUAL Side determine_winner_and_go_next_round() const;
+    CSXD_VIRTUAL vector<shared_ptr<Player>> get_scoreboard(Side side) const;
+    CSXD_VIRTUAL const pmr::vector<shared_ptr<Player>>& get_scoreboard_view(Side side) const;
+    CSXD_VIRTUAL bool has_ended() const;
+    CSXD_VIRTUAL void take_snapshot(string& snapshot) const;
+    CSXD_VIRTUAL void restore_snapshot(string_view snapshot) const;
+    void set_journal(EventJournal* event_journal, uint rounds_per_snapshot = 0);
+    CSXD_VIRTUAL void recover(string_view journal_contents) const;
 
 protected:
-    virtual void check_player_can_buy_weapon(const shared_ptr<Player>& player, const shared_ptr<Weapon>& weapon) const;
-    virtual bool is_weapon_already_equipped(const shared_ptr<Player>& player, WeaponType weapon_type) const;
-    virtual void check_attack_could_have_occurred(const shared_ptr<Player>& attacker, const shared_ptr<Player>& attacked,
-                                                  WeaponType weapon_type) const;
-    virtual void attacked_died_in_attack(const shared_ptr<Player>& attacker, const shared_ptr<Player>& attacked,
-                                         const shared_ptr<Weapon>& weapon) const;
-    virtual void drop_weapon_if_equipped(const shared_ptr<Player>& player, WeaponType weapon_type) const;
-    virtual void go_next_round_or_end() const;
-    virtual void find_winner_loser(Side& winner_side, Side& loser_side) const;
-    virtual void reset_players_and_add_money(Side side, uint money) const;
+    CSXD_VIRTUAL ActionResult try_buy_weapon_for(const shared_ptr<Player>& player, const shared_ptr<Weapon>& weapon) const;
+    CSXD_VIRTUAL ActionResult try_attack_between(const shared_ptr<Player>& attacker, const shared_ptr<Player>& attacked,
+                                            WeaponType weapon_type) const;
+    CSXD_VIRTUAL ActionResult check_player_can_buy_weapon(const shared_ptr<Player>& player,
+                                                     const shared_ptr<Weapon>& weapon) const;
+    CSXD_VIRTUAL bool is_weapon_already_equipped(const shared_ptr<Player>& player, WeaponType weapon_type) const;
+    CSXD_VIRTUAL ActionResult check_attack_could_have_occurred(const shared_ptr<Player>& attacker,
+                                                          const shared_ptr<Player>& attacked,
+                                                          WeaponType weapon_type) const;
+    CSXD_VIRTUAL void attacked_died_in_attack(const shared_ptr<Player>& attacker, const shared_ptr<Player>& attacked,
+                                         const Weapon* weapon) const;
+    CSXD_VIRTUAL void drop_weapon_if_equipped(const shared_ptr<Player>& player, WeaponType weapon_type) const;
+    CSXD_VIRTUAL void go_next_round_or_end() const;
+    CSXD_VIRTUAL void find_winner_loser(Side& winner_side, Side& loser_side) const;
+    CSXD_VIRTUAL void reset_players_and_add_money(Side side, uint money) const;
+    CSXD_VIRTUAL Side finish_round() const;
+    CSXD_VIRTUAL void update_catalog() const;
+    CSXD_VIRTUAL void apply_journal_event(const JournalEvent& event) const;
+    void journal_round_ended(Side winner_side) const;
     static bool scoreboard_comparer(const shared_ptr<Player>& p1, const shared_ptr<Player>& p2);
 
     const ull ROUND_LENGTH = (2 * 60 + 15) * 1000;
@@ -54,6 +94,12 @@ protected:
     const size_t MAX_TEAM_SIZE = 10;
 
     shared_ptr<Game> game;
+    mutable shared_ptr<const WeaponCatalog> catalog;
+    /// Whether the catalog changed since the last snapshot was journaled
+    mutable bool catalog_changed;
+    EventJournal* journal;
+    uint snapshot_interval;
+    mutable string snapshot_buffer;
 };
 
 
@@ -1,59 +1,118 @@
 #include <utility>
 
 #include "Interactions.h"
-#include "exceptions/ActionAtIllegalTimeException.h"
-#include "exceptions/ActionFromDeadPlayerException.h"
-#include "exceptions/AttackDeadPlayerException.h"
-#include "exceptions/FriendlyFireException.h"
-#include "exceptions/NotEnoughMoneyException.h"
-#include "exceptions/NullPointerException.h"
 #include "exceptions/PlayerAlreadyInTeamException.h"
 #include "exceptions/PlayerInOpponentTeamException.h"
 #include "exceptions/PlayerNotFoundException.h"
 #include "exceptions/TeamIsFullException.h"
-#include "exceptions/WeaponNotAvailableException.h"
-#include "exceptions/WeaponNotEquippedException.h"
-#include "exceptions/WeaponOfThisTypeAlreadyEquippedException.h"
+#include "utils/trace/Trace.h"
 
-istream* Interactions::in = &cin;
-ostream* Interactions::out = &cout;
-uint Interactions::rounds;
-shared_ptr<GamePlay> Interactions::game_play;
+Interactions::Interactions() : tokenizer(cin), first_token(), second_token(), third_token(), out(cout), flush_per_command(false), recorder(nullptr), latencies(nullptr), outcomes(), tap_results(), rounds(0), command_count(0), counter_terrorist_round_wins(0), terrorist_round_wins(0), game_play() {}
 
 void Interactions::set_input_stream(istream& stream) {
-    in = &stream;
+    tokenizer.reset(stream);
+}
+
+void Interactions::set_input_buffer(string_view buffer) {
+    tokenizer.reset(buffer);
 }
 
 void Interactions::set_output_stream(ostream& stream) {
-    out = &stream;
+    out.reset(stream);
+}
+
+void Interactions::set_flush_per_command(bool enabled) {
+    flush_per_command = enabled;
+}
+
+/// Every command read from the text input is also written to the recorder, until it is unset with nullptr
+void Interactions::set_recorder(MatchLogWriter* match_log_writer) {
+    recorder = match_log_writer;
+}
+
+/// Text commands and round ends are timed into the latencies, until they are unset with nullptr
+void Interactions::set_latencies(CommandLatencies* command_latencies) {
+    latencies = command_latencies;
 }
 
 void Interactions::init() {
-    *in >> rounds;
+    rounds = tokenizer.next_uint();
+    if (recorder != nullptr) {
+        recorder->begin_match(rounds);
+    }
 }
 
-uint Interactions::get_rounds() {
+uint Interactions::get_rounds() const {
     return rounds;
 }
 
 void Interactions::set_game_play(shared_ptr<GamePlay> game_play) {
-    Interactions::game_play = game_play;
+    this->game_play = std::move(game_play);
+}
+
+const shared_ptr<GamePlay>& Interactions::get_game_play() const {
+    return game_play;
 }
 
+/// Answers already buffered are written out before an exception leaves, as they would have been without the buffer
 void Interactions::begin() {
-    string command;
-    uint command_count;
+    try {
+        while (!has_ended()) {
+            play_round();
+        }
+    }
+    catch (...) {
+        out.flush();
+        throw;
+    }
+}
 
-    while (!game_play->has_ended()) {
-        *in >> command >> command_count;
+void Interactions::play_round() {
+    tokenizer.next();
+    uint round_command_count = tokenizer.next_uint();
+    if (recorder != nullptr) {
+        recorder->begin_round(round_command_count);
+    }
 
-        while (command_count--) {
-            *in >> command;
-            execute_command(get_command_from_string(command));
+    while (round_command_count--) {
+        Command command = get_command_from_string(tokenizer.next());
+        CSXD_TRACE_SPAN(get_command_name(command).data());
+        if (latencies != nullptr && latencies->should_sample()) {
+            auto started_at = CommandLatencies::now();
+            execute_command(command);
+            latencies->record(command, started_at);
+        }
+        else {
+            execute_command(command);
         }
+        finish_command();
+    }
 
-        output_winner_and_go_next_round();
+    end_round();
+}
+
+bool Interactions::has_ended() const {
+    return game_play->has_ended();
+}
+
+ull Interactions::get_command_count() const {
+    return command_count;
+}
+
+uint Interactions::get_round_wins(Side side) const {
+    uint wins = 0;
+    if (side & COUNTER_TERRORIST) {
+        wins += counter_terrorist_round_wins;
+    }
+    if (side & TERRORIST) {
+        wins += terrorist_round_wins;
     }
+    return wins;
+}
+
+/// How every command of the match was answered so far
+const OutcomeCounters& Interactions::get_outcomes() const {
+    return outcomes;
 }
 
 void Interactions::execute_command(Command command) {
@@ -89,168 +148,391 @@ void Interactions::output_winner_and_go_next_round() {
     auto round_winner = game_play->determine_winner_and_go_next_round();
 
     if (round_winner == COUNTER_TERRORIST) {
-        *out << "Counter-Terrorist won" << endl;
+        counter_terrorist_round_wins++;
+        out << "Counter-Terrorist won" << '\n';
     }
     else {
-        *out << "Terrorist won" << endl;
+        terrorist_round_wins++;
+        out << "Terrorist won" << '\n';
     }
 }
 
-void Interactions::add_user() {
-    string name, side;
-    *in >> name >> side;
+PlayerHandle Interactions::add_user(const string& name, Side side, ull time) {
+    game_play->set_round_time(time);
+    PlayerHandle player = add_player(name, side);
+    finish_command();
+    return player;
+}
+
+void Interactions::get_health(PlayerHandle player, ull time) {
+    game_play->set_round_time(time);
+    output_hp(player);
+    finish_command();
+}
 
-    update_round_time();
+void Interactions::get_money(PlayerHandle player, ull time) {
+    game_play->set_round_time(time);
+    output_money(player);
+    finish_command();
+}
 
-    try {
-        auto player = game_play->create_player(name, get_side_from_string(side));
+void Interactions::buy(PlayerHandle player, const shared_ptr<Weapon>& weapon, ull time) {
+    game_play->set_round_time(time);
+    output_buy_result(game_play->try_buy_weapon(player, weapon), weapon);
+    finish_command();
+}
 
-        game_play->add_player(player);
+void Interactions::tap(PlayerHandle attacker, PlayerHandle attacked, WeaponType weapon_type, ull time) {
+    game_play->set_round_time(time);
+    output_tap_result(game_play->try_attack_occurred(attacker, attacked, weapon_type));
+    finish_command();
+}
 
-        *out << "this user added to " << side << endl;
+/// A burst of TAP commands at one time, answered like as many tap() calls but resolved in one batch
+void Interactions::taps(const AttackEvent* events, size_t count, ull time) {
+    game_play->set_round_time(time);
+    tap_results.resize(count);
+    game_play->try_attacks_occurred(events, count, tap_results.data());
+    for (size_t i = 0; i < count; i++) {
+        output_tap_result(tap_results[i]);
+        finish_command();
     }
-    catch (const PlayerAlreadyInTeamException& ex) {
-        *out << "you are already in this game" << endl;
-    }
-    catch (const PlayerInOpponentTeamException& ex) {
-        *out << "you are already in this game" << endl;
+}
+
+void Interactions::scoreboard(ull time) {
+    game_play->set_round_time(time);
+    output_scoreboard();
+    finish_command();
+}
+
+/// A command whose arguments could not be parsed, answered like the textual command with an unknown side or weapon type
+void Interactions::reject(ull time) {
+    game_play->set_round_time(time);
+    outcomes.count(OutcomeCounters::UNPARSED_ROW, INVALID_ARGUMENTS_OUTCOME);
+    out << "unknown error" << '\n';
+    finish_command();
+}
+
+void Interactions::end_round() {
+    if (latencies != nullptr) {
+        auto started_at = CommandLatencies::now();
+        output_winner_and_go_next_round();
+        latencies->record_round_end(started_at);
     }
-    catch (const TeamIsFullException& ex) {
-        *out << "this team is full" << endl;
+    else {
+        output_winner_and_go_next_round();
     }
-    catch (...) {
-        *out << "unknown error" << endl;
+    out.flush();
+}
+
+void Interactions::finish_command() {
+    command_count++;
+    if (flush_per_command) {
+        out.flush();
     }
 }
 
-void Interactions::get_health() {
-    string player_name;
-    *in >> player_name;
+void Interactions::add_user() {
+    CSXD_TRACE_BEGIN(parse);
+    const string& name = read_token(first_token);
+    const string& side = read_token(second_token);
 
-    update_round_time();
+    ull time = update_round_time();
 
+    Side player_side;
     try {
-        *out << game_play->get_hp(player_name) << endl;
-    }
-    catch (const PlayerNotFoundException& ex) {
-        *out << "invalid username" << endl;
+        player_side = get_side_from_string(side);
     }
     catch (...) {
-        *out << "unknown error" << endl;
+        if (recorder != nullptr) {
+            recorder->reject(time);
+        }
+        outcomes.count(ADD_USER, INVALID_ARGUMENTS_OUTCOME);
+        out << "unknown error" << '\n';
+        return;
     }
-}
+    CSXD_TRACE_END(parse);
 
-void Interactions::get_money() {
-    string player_name;
-    *in >> player_name;
+    if (recorder != nullptr) {
+        recorder->add_user(name, player_side, time);
+    }
+    add_player(name, player_side);
+}
 
-    update_round_time();
+void Interactions::get_health() {
+    CSXD_TRACE_BEGIN(parse);
+    const string& player_name = read_token(first_token);
 
-    try {
-        *out << game_play->get_money(player_name) << endl;
+    ull time = update_round_time();
+    CSXD_TRACE_END(parse);
+    if (recorder != nullptr) {
+        recorder->get_health(player_name, time);
     }
-    catch (const PlayerNotFoundException& ex) {
-        *out << "invalid username" << endl;
-    }
-    catch (...) {
-        *out << "unknown error" << endl;
+
+    output_hp(player_name);
+}
+
+void Interactions::get_money() {
+    CSXD_TRACE_BEGIN(parse);
+    const string& player_name = read_token(first_token);
+
+    ull time = update_round_time();
+    CSXD_TRACE_END(parse);
+    if (recorder != nullptr) {
+        recorder->get_money(player_name, time);
     }
+
+    output_money(player_name);
 }
 
 void Interactions::buy() {
-    string player_name, weapon_name;
-    *in >> player_name >> weapon_name;
+    CSXD_TRACE_BEGIN(parse);
+    const string& player_name = read_token(first_token);
+    const string& weapon_name = read_token(second_token);
 
-    update_round_time();
+    ull time = update_round_time();
+    if (recorder != nullptr) {
+        recorder->buy(player_name, weapon_name, time);
+    }
 
-    shared_ptr<Weapon> weapon = Data::try_get_weapon_by_name(weapon_name);
+    shared_ptr<Weapon> weapon = game_play->try_get_weapon_by_name(weapon_name);
+    CSXD_TRACE_END(parse);
+
+    output_buy_result(game_play->try_buy_weapon(player_name, weapon), weapon);
+}
 
+void Interactions::tap() {
+    CSXD_TRACE_BEGIN(parse);
+    const string& attacker_name = read_token(first_token);
+    const string& attacked_name = read_token(second_token);
+    const string& weapon_type = read_token(third_token);
+
+    ull time = update_round_time();
+
+    WeaponType attack_weapon_type;
     try {
-        game_play->buy_weapon(player_name, weapon);
+        attack_weapon_type = get_weapon_type_from_string(weapon_type);
+    }
+    catch (...) {
+        if (recorder != nullptr) {
+            recorder->reject(time);
+        }
+        outcomes.count(TAP, INVALID_ARGUMENTS_OUTCOME);
+        out << "unknown error" << '\n';
+        return;
+    }
+    CSXD_TRACE_END(parse);
 
-        *out << "I hope you can use it" << endl;
+    if (recorder != nullptr) {
+        recorder->tap(attacker_name, attacked_name, attack_weapon_type, time);
     }
-    catch (const PlayerNotFoundException& ex) {
-        *out << "invalid username" << endl;
+
+    ActionResult result;
+    try {
+        result = game_play->try_attack_occurred(attacker_name, attacked_name, attack_weapon_type);
     }
-    catch (const ActionFromDeadPlayerException& ex) {
-        *out << "deads can not buy" << endl;
+    catch (...) {
+        outcomes.count(TAP, UNKNOWN_ERROR_OUTCOME);
+        out << "unknown error" << '\n';
+        return;
     }
-    catch (const ActionAtIllegalTimeException& ex) {
-        *out << "you are out of time" << endl;
+
+    output_tap_result(result);
+}
+
+void Interactions::scoreboard() {
+    CSXD_TRACE_BEGIN(parse);
+    ull time = update_round_time();
+    CSXD_TRACE_END(parse);
+    if (recorder != nullptr) {
+        recorder->scoreboard(time);
     }
-    catch (const NullPointerException& ex) {
-        *out << "invalid category gun" << endl;
+
+    output_scoreboard();
+}
+
+PlayerHandle Interactions::add_player(const string& name, Side side) {
+    try {
+        CSXD_TRACE_BEGIN(execute);
+        auto player = game_play->create_player(name, side);
+
+        PlayerHandle handle = game_play->add_player(player);
+        CSXD_TRACE_END(execute);
+
+        outcomes.count(ADD_USER, ACCEPTED_OUTCOME);
+        out << "this user added to " << (side == TERRORIST ? "Terrorist" : "Counter-Terrorist") << '\n';
+        return handle;
     }
-    catch (const WeaponNotAvailableException& ex) {
-        *out << "invalid category gun" << endl;
+    catch (const PlayerAlreadyInTeamException& ex) {
+        outcomes.count(ADD_USER, PLAYER_ALREADY_IN_GAME_OUTCOME);
+        out << "you are already in this game" << '\n';
     }
-    catch (const WeaponOfThisTypeAlreadyEquippedException& ex) {
-        *out << "you have a " << (weapon->get_type() == PISTOL ? "pistol" : "heavy") << endl;
+    catch (const PlayerInOpponentTeamException& ex) {
+        outcomes.count(ADD_USER, PLAYER_ALREADY_IN_GAME_OUTCOME);
+        out << "you are already in this game" << '\n';
     }
-    catch (const NotEnoughMoneyException& ex) {
-        *out << "no enough money" << endl;
+    catch (const TeamIsFullException& ex) {
+        outcomes.count(ADD_USER, TEAM_FULL_OUTCOME);
+        out << "this team is full" << '\n';
     }
     catch (...) {
-        *out << "unknown error" << endl;
+        outcomes.count(ADD_USER, UNKNOWN_ERROR_OUTCOME);
+        out << "unknown error" << '\n';
     }
+    return NO_PLAYER;
 }
 
-void Interactions::tap() {
-    string attacker_name, attacked_name, weapon_type;
-    *in >> attacker_name >> attacked_name >> weapon_type;
-
-    update_round_time();
-
+/// PlayerKey is a player name or a PlayerHandle
+template <typename PlayerKey>
+void Interactions::output_hp(const PlayerKey& player) {
+    CSXD_TRACE_SPAN("respond");
     try {
-        game_play->attack_occurred(attacker_name, attacked_name, get_weapon_type_from_string(weapon_type));
-
-        *out << "nice shot" << endl;
+        out << game_play->get_hp(player) << '\n';
+        outcomes.count(GET_HEALTH, ACCEPTED_OUTCOME);
     }
     catch (const PlayerNotFoundException& ex) {
-        *out << "invalid username" << endl;
-    }
-    catch (const ActionFromDeadPlayerException& ex) {
-        *out << "attacker is dead" << endl;
+        outcomes.count(GET_HEALTH, PLAYER_NOT_FOUND_OUTCOME);
+        out << "invalid username" << '\n';
     }
-    catch (const AttackDeadPlayerException& ex) {
-        *out << "attacked is dead" << endl;
+    catch (...) {
+        outcomes.count(GET_HEALTH, UNKNOWN_ERROR_OUTCOME);
+        out << "unknown error" << '\n';
     }
-    catch (const WeaponNotEquippedException& ex) {
-        *out << "no such gun" << endl;
+}
+
+template <typename PlayerKey>
+void Interactions::output_money(const PlayerKey& player) {
+    CSXD_TRACE_SPAN("respond");
+    try {
+        out << game_play->get_money(player) << '\n';
+        outcomes.count(GET_MONEY, ACCEPTED_OUTCOME);
     }
-    catch (const FriendlyFireException& ex) {
-        *out << "friendly fire" << endl;
+    catch (const PlayerNotFoundException& ex) {
+        outcomes.count(GET_MONEY, PLAYER_NOT_FOUND_OUTCOME);
+        out << "invalid username" << '\n';
     }
     catch (...) {
-        *out << "unknown error" << endl;
+        outcomes.count(GET_MONEY, UNKNOWN_ERROR_OUTCOME);
+        out << "unknown error" << '\n';
     }
 }
 
-void Interactions::scoreboard() {
-    update_round_time();
+void Interactions::output_buy_result(ActionResult result, const shared_ptr<Weapon>& weapon) {
+    CSXD_TRACE_SPAN("respond");
+    outcomes.count(BUY, OutcomeCounters::get_outcome(result));
+    switch (result) {
+        case SUCCESS: {
+            out << "I hope you can use it" << '\n';
+            break;
+        }
+        case PLAYER_NOT_FOUND: {
+            out << "invalid username" << '\n';
+            break;
+        }
+        case ACTION_FROM_DEAD_PLAYER: {
+            out << "deads can not buy" << '\n';
+            break;
+        }
+        case ACTION_AT_ILLEGAL_TIME: {
+            out << "you are out of time" << '\n';
+            break;
+        }
+        case WEAPON_NOT_FOUND:
+        case WEAPON_NOT_AVAILABLE: {
+            out << "invalid category gun" << '\n';
+            break;
+        }
+        case WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED: {
+            out << "you have a " << (weapon->get_type() == PISTOL ? "pistol" : "heavy") << '\n';
+            break;
+        }
+        case NOT_ENOUGH_MONEY: {
+            out << "no enough money" << '\n';
+            break;
+        }
+        default: {
+            out << "unknown error" << '\n';
+            break;
+        }
+    }
+}
 
-    *out << "Counter-Terrorist-Players:" << endl;
+void Interactions::output_tap_result(ActionResult result) {
+    CSXD_TRACE_SPAN("respond");
+    outcomes.count(TAP, OutcomeCounters::get_outcome(result));
+    switch (result) {
+        case SUCCESS: {
+            out << "nice shot" << '\n';
+            break;
+        }
+        case PLAYER_NOT_FOUND: {
+            out << "invalid username" << '\n';
+            break;
+        }
+        case ACTION_FROM_DEAD_PLAYER: {
+            out << "attacker is dead" << '\n';
+            break;
+        }
+        case ATTACK_DEAD_PLAYER: {
+            out << "attacked is dead" << '\n';
+            break;
+        }
+        case WEAPON_NOT_EQUIPPED: {
+            out << "no such gun" << '\n';
+            break;
+        }
+        case FRIENDLY_FIRE: {
+            out << "friendly fire" << '\n';
+            break;
+        }
+        default: {
+            out << "unknown error" << '\n';
+            break;
+        }
+    }
+}
+
+void Interactions::output_scoreboard() {
+    CSXD_TRACE_SPAN("respond");
+    outcomes.count(SCORE_BOARD, ACCEPTED_OUTCOME);
+    out << "Counter-Terrorist-Players:" << '\n';
     print_scoreboard(COUNTER_TERRORIST);
 
-    *out << "Terrorist-Players:" << endl;
+    out << "Terrorist-Players:" << '\n';
     print_scoreboard(TERRORIST);
 }
 
 void Interactions::print_scoreboard(Side side) {
     uint rank = 1;
-    for(const auto& player : game_play->get_scoreboard(side)) {
-        *out << rank++ << " " << player->get_name() << " " << player->get_kills() << " " << player->get_deaths() << endl;
+    for(const auto& player : game_play->get_scoreboard_view(side)) {
+        out << rank++ << " " << player->get_name() << " " << player->get_kills() << " " << player->get_deaths() << '\n';
     }
 }
 
-void Interactions::update_round_time() {
-    string time;
-    *in >> time;
-    game_play->set_round_time(get_time_from_string(time));
+ull Interactions::update_round_time() {
+    ull time = get_time_from_string(tokenizer.next());
+    game_play->set_round_time(time);
+    return time;
 }
 
-ull Interactions::get_time_from_string(const string& time) {
+/// Copies the token into a reused buffer, so it outlives the tokenizer's line and does not allocate once the buffer has grown
+const string& Interactions::read_token(string& buffer) {
+    auto token = tokenizer.next();
+    buffer.assign(token.data(), token.size());
+    return buffer;
+}
+
+/// A missing or malformed time is rejected like a malformed round header, as the digits are read by position
+ull Interactions::get_time_from_string(string_view time) {
+    if (time.size() != 9 || time[2] != ':' || time[5] != ':') {
+        throw invalid_argument("time is invalid. should be in the format: mm:ss:SSS");
+    }
+    for (size_t i : {0, 1, 3, 4, 6, 7, 8}) {
+        if (time[i] < '0' || time[i] > '9') {
+            throw invalid_argument("time is invalid. should be in the format: mm:ss:SSS");
+        }
+    }
+
     ull t = 0;
     t += (time[0] - '0') * 10 * 60 * 1000;
     t += (time[1] - '0') * 60 * 1000;
@@ -262,36 +544,69 @@ ull Interactions::get_time_from_string(const string& time) {
     return t;
 }
 
-Command Interactions::get_command_from_string(const string& command) {
-    if (command == "ADD-USER")
-        return ADD_USER;
-    if (command == "GET-HEALTH")
-        return GET_HEALTH;
-    if (command == "GET-MONEY")
-        return GET_MONEY;
-    if (command == "BUY")
-        return BUY;
-    if (command == "TAP")
-        return TAP;
-    if (command == "SCORE-BOARD")
-        return SCORE_BOARD;
+Command Interactions::get_command_from_string(string_view command) {
+    switch (command.size()) {
+        case 3: {
+            if (command == "BUY")
+                return BUY;
+            if (command == "TAP")
+                return TAP;
+            break;
+        }
+        case 8: {
+            if (command == "ADD-USER")
+                return ADD_USER;
+            break;
+        }
+        case 9: {
+            if (command == "GET-MONEY")
+                return GET_MONEY;
+            break;
+        }
+        case 10: {
+            if (command == "GET-HEALTH")
+                return GET_HEALTH;
+            break;
+        }
+        case 11: {
+            if (command == "SCORE-BOARD")
+                return SCORE_BOARD;
+            break;
+        }
+    }
     throw invalid_argument("command is invalid. should be one of: [ADD-USER, GET-HEALTH, GET-MONEY, BUY, TAP, SCORE-BOARD]");
 }
 
-Side Interactions::get_side_from_string(const string& side) {
-    if (side == "Counter-Terrorist")
-        return COUNTER_TERRORIST;
-    if (side == "Terrorist")
-        return TERRORIST;
+Side Interactions::get_side_from_string(string_view side) {
+    switch (side.size()) {
+        case 17: {
+            if (side == "Counter-Terrorist")
+                return COUNTER_TERRORIST;
+            break;
+        }
+        case 9: {
+            if (side == "Terrorist")
+                return TERRORIST;
+            break;
+        }
+    }
     throw invalid_argument("side is invalid. should be one of: [Counter-Terrorist, Terrorist]");
 }
 
-WeaponType Interactions::get_weapon_type_from_string(const string& weapon_type) {
-    if (weapon_type == "knife")
-        return MELEE;
-    if (weapon_type == "pistol")
-        return PISTOL;
-    if (weapon_type == "heavy")
-        return HEAVY;
+WeaponType Interactions::get_weapon_type_from_string(string_view weapon_type) {
+    switch (weapon_type.size()) {
+        case 5: {
+            if (weapon_type == "knife")
+                return MELEE;
+            if (weapon_type == "heavy")
+                return HEAVY;
+            break;
+        }
+        case 6: {
+            if (weapon_type == "pistol")
+                return PISTOL;
+            break;
+        }
+    }
     throw invalid_argument("weapon_type is invalid. should be one of: [knife, pistol, heavy]");
 }
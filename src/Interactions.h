@@ -3,13 +3,20 @@
 
 
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <algorithm>
+#include <vector>
 
 #include "Command.h"
 #include "models/weapon/WeaponType.h"
 #include "models/player/Side.h"
 #include "utils/data/Data.h"
+#include "utils/parser/Tokenizer.h"
+#include "utils/output/OutputBuffer.h"
+#include "utils/matchlog/MatchLogWriter.h"
+#include "utils/metrics/CommandLatencies.h"
+#include "utils/metrics/OutcomeCounters.h"
 #include "GamePlay.h"
 
 using namespace std;
@@ -18,33 +25,78 @@ typedef unsigned long long ull;
 
 class Interactions {
 public:
-    static void set_input_stream(istream& stream);
-    static void set_output_stream(ostream& stream);
-    static void init();
-    static uint get_rounds();
-    static void set_game_play(shared_ptr<GamePlay> game_play);
-    static void begin();
+    Interactions();
+    Interactions(const Interactions&) = delete;
+    Interactions& operator=(const Interactions&) = delete;
+
+    void set_input_stream(istream& stream);
+    void set_input_buffer(string_view buffer);
+    void set_output_stream(ostream& stream);
+    void set_flush_per_command(bool enabled);
+    void set_recorder(MatchLogWriter* match_log_writer);
+    void set_latencies(CommandLatencies* command_latencies);
+    void init();
+    uint get_rounds() const;
+    void set_game_play(shared_ptr<GamePlay> game_play);
+    const shared_ptr<GamePlay>& get_game_play() const;
+    void begin();
+    void play_round();
+    bool has_ended() const;
+    ull get_command_count() const;
+    uint get_round_wins(Side side) const;
+    const OutcomeCounters& get_outcomes() const;
+
+    /// Commands that were already parsed elsewhere, such as from a binary match log. Each one answers exactly like its
+    /// textual counterpart; end_round() closes the round like the end of a ROUND block does.
+    PlayerHandle add_user(const string& name, Side side, ull time);
+    void get_health(PlayerHandle player, ull time);
+    void get_money(PlayerHandle player, ull time);
+    void buy(PlayerHandle player, const shared_ptr<Weapon>& weapon, ull time);
+    void tap(PlayerHandle attacker, PlayerHandle attacked, WeaponType weapon_type, ull time);
+    void taps(const AttackEvent* events, size_t count, ull time);
+    void scoreboard(ull time);
+    void reject(ull time);
+    void end_round();
 
 private:
-    static void execute_command(Command command);
-    static void output_winner_and_go_next_round();
-    static void add_user();
-    static void get_health();
-    static void get_money();
-    static void buy();
-    static void tap();
-    static void scoreboard();
-    static void print_scoreboard(Side side);
-    static void update_round_time();
-    static ull get_time_from_string(const string& time);
-    static Command get_command_from_string(const string& command);
-    static Side get_side_from_string(const string& side);
-    static WeaponType get_weapon_type_from_string(const string& weapon_type);
-
-    static istream* in;
-    static ostream* out;
-    static uint rounds;
-    static shared_ptr<GamePlay> game_play;
+    void execute_command(Command command);
+    void finish_command();
+    void output_winner_and_go_next_round();
+    void add_user();
+    void get_health();
+    void get_money();
+    void buy();
+    void tap();
+    void scoreboard();
+    PlayerHandle add_player(const string& name, Side side);
+    template <typename PlayerKey> void output_hp(const PlayerKey& player);
+    template <typename PlayerKey> void output_money(const PlayerKey& player);
+    void output_buy_result(ActionResult result, const shared_ptr<Weapon>& weapon);
+    void output_tap_result(ActionResult result);
+    void output_scoreboard();
+    void print_scoreboard(Side side);
+    ull update_round_time();
+    const string& read_token(string& buffer);
+    static ull get_time_from_string(string_view time);
+    static Command get_command_from_string(string_view command);
+    static Side get_side_from_string(string_view side);
+    static WeaponType get_weapon_type_from_string(string_view weapon_type);
+
+    Tokenizer tokenizer;
+    string first_token;
+    string second_token;
+    string third_token;
+    OutputBuffer out;
+    bool flush_per_command;
+    MatchLogWriter* recorder;
+    CommandLatencies* latencies;
+    OutcomeCounters outcomes;
+    vector<ActionResult> tap_results;
+    uint rounds;
+    ull command_count;
+    uint counter_terrorist_round_wins;
+    uint terrorist_round_wins;
+    shared_ptr<GamePlay> game_play;
 };
 
 
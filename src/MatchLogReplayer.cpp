@@ -0,0 +1,130 @@
+#include <stdexcept>
+
+#include "MatchLogReplayer.h"
+
+MatchLogReplayer::MatchLogReplayer(string_view log, ostream& output, PlayerStorage storage) : reader(log), arena(), interactions(), game_play(), player_handles(), weapons(), weapons_catalog_version(0), taps(), taps_time(0) {
+    game_play = make_shared<GamePlay>(reader.get_rounds(), storage, &arena);
+    weapons_catalog_version = game_play->get_catalog_version();
+    interactions.set_output_stream(output);
+    interactions.set_game_play(game_play);
+}
+
+void MatchLogReplayer::replay() {
+    while (!has_ended() && play_round()) {
+    }
+}
+
+/// Returns false if the log has no more rounds
+bool MatchLogReplayer::play_round() {
+    MatchLogRecord record;
+    if (!reader.next(record)) {
+        return false;
+    }
+    if (record.type != ROUND_RECORD) {
+        throw invalid_argument("match log round is expected");
+    }
+    if (weapons_catalog_version != game_play->get_catalog_version()) {
+        weapons.clear();
+        weapons_catalog_version = game_play->get_catalog_version();
+    }
+
+    for (uint i = 0; i < record.command_count; i++) {
+        MatchLogRecord command;
+        if (!reader.next(command) || command.type == ROUND_RECORD) {
+            throw invalid_argument("match log round is incomplete");
+        }
+        if (command.type == TAP_RECORD) {
+            add_tap(command);
+        }
+        else {
+            flush_taps();
+            execute(command);
+        }
+    }
+    flush_taps();
+
+    interactions.end_round();
+    return true;
+}
+
+bool MatchLogReplayer::has_ended() const {
+    return interactions.has_ended();
+}
+
+ull MatchLogReplayer::get_command_count() const {
+    return interactions.get_command_count();
+}
+
+uint MatchLogReplayer::get_round_wins(Side side) const {
+    return interactions.get_round_wins(side);
+}
+
+void MatchLogReplayer::execute(const MatchLogRecord& record) {
+    switch (record.type) {
+        case ADD_USER_RECORD: {
+            PlayerHandle handle = interactions.add_user(string(reader.get_player_name(record.player)), record.side,
+                                                        record.time);
+            if (handle != NO_PLAYER && player_handle(record.player) == NO_PLAYER) {
+                player_handles[record.player] = handle;
+            }
+            break;
+        }
+        case GET_HEALTH_RECORD: {
+            interactions.get_health(player_handle(record.player), record.time);
+            break;
+        }
+        case GET_MONEY_RECORD: {
+            interactions.get_money(player_handle(record.player), record.time);
+            break;
+        }
+        case BUY_RECORD: {
+            interactions.buy(player_handle(record.player), weapon(record.weapon), record.time);
+            break;
+        }
+        case TAP_RECORD: {
+            interactions.tap(player_handle(record.player), player_handle(record.other_player), record.weapon_type,
+                             record.time);
+            break;
+        }
+        case SCORE_BOARD_RECORD: {
+            interactions.scoreboard(record.time);
+            break;
+        }
+        default: {
+            interactions.reject(record.time);
+            break;
+        }
+    }
+}
+
+/// TAPs at the same time are buffered and resolved together, since nothing can happen between them
+void MatchLogReplayer::add_tap(const MatchLogRecord& record) {
+    if (!taps.empty() && record.time != taps_time) {
+        flush_taps();
+    }
+    taps.push_back({player_handle(record.player), player_handle(record.other_player), record.weapon_type});
+    taps_time = record.time;
+}
+
+void MatchLogReplayer::flush_taps() {
+    if (!taps.empty()) {
+        interactions.taps(taps.data(), taps.size(), taps_time);
+        taps.clear();
+    }
+}
+
+/// Players that were never added successfully keep NO_PLAYER, so their commands fail like unknown names do
+PlayerHandle MatchLogReplayer::player_handle(uint player) {
+    if (player >= player_handles.size()) {
+        player_handles.resize(reader.get_player_count(), NO_PLAYER);
+    }
+    return player_handles[player];
+}
+
+/// Weapons are looked up in the catalog once per interned name
+const shared_ptr<Weapon>& MatchLogReplayer::weapon(uint weapon_id) {
+    while (weapons.size() <= weapon_id) {
+        weapons.push_back(game_play->try_get_weapon_by_name(string(reader.get_weapon_name(weapons.size()))));
+    }
+    return weapons[weapon_id];
+}
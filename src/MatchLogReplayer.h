@@ -0,0 +1,55 @@
+#ifndef CSXD_MATCHLOGREPLAYER_H
+#define CSXD_MATCHLOGREPLAYER_H
+
+
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "utils/matchlog/MatchLogReader.h"
+#include "utils/memory/MatchArena.h"
+#include "models/game/PlayerHandle.h"
+#include "Interactions.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Plays a binary match log through the pre-parsed command API of Interactions, producing the same output as the
+/// textual match it was recorded from. Interned player ids are resolved to player handles once, when ADD-USER
+/// succeeds, so commands neither tokenize, parse times nor hash names. Weapons are resolved once per catalog version.
+/// Consecutive TAPs at the same time are resolved as one burst. The match is allocated from an arena owned by the
+/// replayer and released with it.
+class MatchLogReplayer {
+public:
+    MatchLogReplayer(string_view log, ostream& output, PlayerStorage storage = DENSE_PLAYER_ARRAYS);
+    MatchLogReplayer(const MatchLogReplayer&) = delete;
+    MatchLogReplayer& operator=(const MatchLogReplayer&) = delete;
+
+    void replay();
+    bool play_round();
+    bool has_ended() const;
+    ull get_command_count() const;
+    uint get_round_wins(Side side) const;
+
+private:
+    void execute(const MatchLogRecord& record);
+    void add_tap(const MatchLogRecord& record);
+    void flush_taps();
+    PlayerHandle player_handle(uint player);
+    const shared_ptr<Weapon>& weapon(uint weapon_id);
+
+    MatchLogReader reader;
+    MatchArena arena;
+    Interactions interactions;
+    shared_ptr<GamePlay> game_play;
+    vector<PlayerHandle> player_handles;
+    vector<shared_ptr<Weapon>> weapons;
+    ull weapons_catalog_version;
+    vector<AttackEvent> taps;
+    ull taps_time;
+};
+
+
+#endif //CSXD_MATCHLOGREPLAYER_H
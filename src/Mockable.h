@@ -0,0 +1,14 @@
+#ifndef CSXD_MOCKABLE_H
+#define CSXD_MOCKABLE_H
+
+
+/// Methods that test/mocks override are declared CSXD_VIRTUAL. They are only virtual in the mockable build the tests
+/// link against (CSXD_MOCKABLE); the engine itself dispatches them statically, so the compiler can inline them.
+#ifdef CSXD_MOCKABLE
+#define CSXD_VIRTUAL virtual
+#else
+#define CSXD_VIRTUAL
+#endif
+
+
+#endif //CSXD_MOCKABLE_H
@@ -1,16 +1,167 @@
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
 #include "utils/data/Data.h"
+#include "utils/parser/MappedFile.h"
+#include "utils/matchlog/MatchLogWriter.h"
+#include "utils/journal/EventJournal.h"
+#include "utils/metrics/CommandLatencies.h"
+#include "utils/trace/Trace.h"
 #include "GamePlay.h"
 #include "Interactions.h"
+#include "MatchLogReplayer.h"
+
+/// Rounds between the snapshots written to the event journal
+const uint JOURNAL_ROUNDS_PER_SNAPSHOT = 10;
+
+namespace {
+
+void print_usage(const char* program) {
+    cerr << "usage: " << program << " [-i] [-d] [-r match_log] [-j journal] [-l latencies] [-m metrics] [-t trace]"
+         << " [-w weapons.json] [match]" << endl
+         << "       " << program << " [-w weapons.json] --replay match_log" << endl;
+}
+
+int run(int argc, char* argv[]) {
+    Interactions interactions;
+    unique_ptr<MappedFile> match_log;
+    unique_ptr<MappedFile> replayed_log;
+    string match_path;
+    string replayed_path;
+    string weapons_path;
+    string recording_path;
+    ofstream recording;
+    unique_ptr<MatchLogWriter> recorder;
+    string journal_path;
+    unique_ptr<EventJournal> journal;
+    string latencies_path;
+    unique_ptr<CommandLatencies> latencies;
+    string metrics_path;
+    string trace_path;
+    bool interactive = false;
+    PlayerStorage storage = PLAYER_OBJECTS;
+    for (int i = 1; i < argc; i++) {
+        string argument = argv[i];
+        if (argument == "-i" || argument == "--interactive") {
+            interactive = true;
+        }
+        else if (argument == "-d" || argument == "--dense") {
+            storage = DENSE_PLAYER_ARRAYS;
+        }
+        else if ((argument == "-r" || argument == "--record") && i + 1 < argc) {
+            recording_path = argv[++i];
+        }
+        else if ((argument == "-j" || argument == "--journal") && i + 1 < argc) {
+            journal_path = argv[++i];
+        }
+        else if ((argument == "-l" || argument == "--latencies") && i + 1 < argc) {
+            latencies_path = argv[++i];
+        }
+        else if ((argument == "-m" || argument == "--metrics") && i + 1 < argc) {
+            metrics_path = argv[++i];
+        }
+        else if ((argument == "-t" || argument == "--trace") && i + 1 < argc) {
+            trace_path = argv[++i];
+        }
+        else if ((argument == "-w" || argument == "--weapons") && i + 1 < argc) {
+            weapons_path = argv[++i];
+        }
+        else if (argument == "--replay" && i + 1 < argc) {
+            replayed_path = argv[++i];
+        }
+        else {
+            match_path = argument;
+        }
+    }
+
+    bool plays_match = interactive || storage != PLAYER_OBJECTS || !match_path.empty() || !recording_path.empty() ||
+                       !journal_path.empty() || !latencies_path.empty() || !metrics_path.empty() || !trace_path.empty();
+    if (!replayed_path.empty() && plays_match) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    if (weapons_path.empty()) {
+        Data::load();
+    }
+    else {
+        Data::load(weapons_path);
+    }
+
+    if (!replayed_path.empty()) {
+        replayed_log = make_unique<MappedFile>(replayed_path);
+        MatchLogReplayer replayer(replayed_log->get_contents(), cout);
+        replayer.replay();
+        return 0;
+    }
 
-int main() {
-    Data::load();
+    interactions.set_flush_per_command(interactive);
+    if (!match_path.empty()) {
+        match_log = make_unique<MappedFile>(match_path);
+        interactions.set_input_buffer(match_log->get_contents());
+    }
+    if (!recording_path.empty()) {
+        recording.open(recording_path, ios::binary);
+        recorder = make_unique<MatchLogWriter>(recording);
+        interactions.set_recorder(recorder.get());
+    }
+    if (!journal_path.empty()) {
+        journal = make_unique<EventJournal>(journal_path);
+    }
+    if (!latencies_path.empty()) {
+        latencies = make_unique<CommandLatencies>();
+        interactions.set_latencies(latencies.get());
+    }
+    if (!trace_path.empty() && !Trace::is_enabled()) {
+        cerr << "tracing is disabled in this build; configure with -DCSXD_TRACING=ON" << endl;
+    }
 
-    Interactions::init();
+    interactions.init();
 
-    auto game_play = make_shared<GamePlay>(Interactions::get_rounds());
-    Interactions::set_game_play(game_play);
+    auto game_play = make_shared<GamePlay>(interactions.get_rounds(), storage);
+    game_play->set_journal(journal.get(), JOURNAL_ROUNDS_PER_SNAPSHOT);
+    interactions.set_game_play(game_play);
 
-    Interactions::begin();
+    interactions.begin();
+
+    if (recorder != nullptr) {
+        recorder->flush();
+    }
+
+    if (!trace_path.empty()) {
+        ofstream trace_file(trace_path);
+        Trace::write_json(trace_file);
+    }
+
+    if (!metrics_path.empty()) {
+        interactions.get_outcomes().write_prometheus_file(metrics_path);
+    }
+
+    if (latencies != nullptr) {
+        ofstream latencies_file(latencies_path);
+        if (latencies_path.size() >= 5 && latencies_path.compare(latencies_path.size() - 5, 5, ".json") == 0) {
+            latencies->write_json(latencies_file);
+        }
+        else {
+            latencies->write_text(latencies_file);
+        }
+    }
 
     return 0;
 }
+
+}
+
+/// Plays a match from a file or stdin, or replays a recorded match log with --replay. Errors in the arguments, the
+/// input or the files are reported on stderr instead of terminating.
+int main(int argc, char* argv[]) {
+    try {
+        return run(argc, argv);
+    }
+    catch (const exception& ex) {
+        cerr << argv[0] << ": " << ex.what() << endl;
+        return 1;
+    }
+}
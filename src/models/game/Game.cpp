@@ -1,4 +1,11 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <unordered_set>
+
 #include "Game.h"
+#include "GameSnapshotFormat.h"
+#include "utils/binary/BinaryEncoding.h"
 #include "exceptions/LastRoundException.h"
 #include "exceptions/NullPointerException.h"
 #include "exceptions/PlayerAlreadyInTeamException.h"
@@ -6,7 +13,7 @@
 #include "exceptions/PlayerNotFoundException.h"
 #include "exceptions/TeamIsFullException.h"
 
-Game::Game(int id, uint rounds, ull round_length, size_t max_team_size) : id(id), rounds(rounds), current_round(1), round_length(round_length), round_time(0), max_team_size(max_team_size), ended(false), counter_terrorist_player_count(0), terrorist_player_count(0), players() {
+Game::Game(int id, uint rounds, ull round_length, size_t max_team_size, PlayerStorage storage, pmr::memory_resource* memory) : id(id), rounds(rounds), current_round(1), round_length(round_length), round_time(0), max_team_size(max_team_size), ended(false), memory(memory), catalog(), counter_terrorist_players(memory), terrorist_players(memory), counter_terrorist_alive_count(0), terrorist_alive_count(0), counter_terrorist_scoreboard(memory), terrorist_scoreboard(memory), storage(storage), player_ids(memory), players(memory), store(memory) {
     if (rounds == 0) {
         throw out_of_range("rounds should be more than 0");
     }
@@ -18,6 +25,10 @@ Game::Game(int id, uint rounds, ull round_length, size_t max_team_size) : id(id)
     }
 }
 
+Game::~Game() {
+    remove_players();
+}
+
 ull Game::get_id() const {
     return id;
 }
@@ -72,26 +83,84 @@ bool Game::has_ended() const {
 
 vector<shared_ptr<Player>> Game::get_all_players(Side side) const {
     vector<shared_ptr<Player>> player_list;
-    for (const auto& player: players) {
-        if(side & player.second->get_side()) {
-            player_list.push_back(player.second);
-        }
+    if (side & COUNTER_TERRORIST) {
+        player_list.insert(player_list.end(), counter_terrorist_players.begin(), counter_terrorist_players.end());
+    }
+    if (side & TERRORIST) {
+        player_list.insert(player_list.end(), terrorist_players.begin(), terrorist_players.end());
     }
     return player_list;
 }
 
+const pmr::vector<shared_ptr<Player>>& Game::get_team(Side side) const {
+    if (side == TERRORIST) {
+        return terrorist_players;
+    }
+    if (side == COUNTER_TERRORIST) {
+        return counter_terrorist_players;
+    }
+    throw invalid_argument("side is invalid. should be one of: [COUNTER_TERRORIST, TERRORIST]");
+}
+
+/// Kept ordered as kills and deaths change, so reading it never sorts or copies
+const pmr::vector<shared_ptr<Player>>& Game::get_scoreboard(Side side) const {
+    const Scoreboard& side_scoreboard = scoreboard(side);
+#ifdef CSXD_CHECK_INVARIANTS
+    assert(side_scoreboard.is_sorted());
+#endif
+    return side_scoreboard.get_players();
+}
+
 shared_ptr<Player> Game::get_player_by_name(const string& name) {
-    if (players.find(name) != players.end()) {
-        return players[name];
+    auto player = find_player_by_name(name);
+    if (player == nullptr) {
+        throw PlayerNotFoundException();
+    }
+    return player;
+}
+
+shared_ptr<Player> Game::find_player_by_name(const string& name) {
+    auto player_id = player_ids.find(name);
+    if (player_id == player_ids.end()) {
+        return nullptr;
+    }
+    return players[player_id->second];
+}
+
+shared_ptr<Player> Game::get_player_by_handle(PlayerHandle handle) const {
+    auto player = find_player_by_handle(handle);
+    if (player == nullptr) {
+        throw PlayerNotFoundException();
+    }
+    return player;
+}
+
+/// Handles index the players in the order they were added, so no name is hashed
+shared_ptr<Player> Game::find_player_by_handle(PlayerHandle handle) const {
+    if (handle >= players.size()) {
+        return nullptr;
     }
-    throw PlayerNotFoundException();
+    return players[handle];
+}
+
+/// Every player in the order they were added, so a handle indexes it
+const pmr::vector<shared_ptr<Player>>& Game::get_players() const {
+    return players;
+}
+
+PlayerHandle Game::get_player_handle(const string& name) const {
+    auto player_id = player_ids.find(name);
+    if (player_id == player_ids.end()) {
+        throw PlayerNotFoundException();
+    }
+    return player_id->second;
 }
 
 vector<shared_ptr<Player>> Game::get_alive_players(Side side) const {
     vector<shared_ptr<Player>> player_list;
-    for(const auto& player : players) {
-        if(side & player.second->get_side() && player.second->is_alive()) {
-            player_list.push_back(player.second);
+    for (const auto& player : get_all_players(side)) {
+        if (player->is_alive()) {
+            player_list.push_back(player);
         }
     }
     return player_list;
@@ -99,32 +168,233 @@ vector<shared_ptr<Player>> Game::get_alive_players(Side side) const {
 
 uint Game::get_alive_player_count(Side side) const {
     uint player_count = 0;
-    for(const auto& player : players) {
-        if(side & player.second->get_side() && player.second->is_alive()) {
-            player_count++;
-        }
+    if (side & COUNTER_TERRORIST) {
+        player_count += counter_terrorist_alive_count;
     }
+    if (side & TERRORIST) {
+        player_count += terrorist_alive_count;
+    }
+#ifdef CSXD_CHECK_INVARIANTS
+    assert(player_count == count_alive_players(side));
+#endif
     return player_count;
 }
 
-void Game::add_player(const shared_ptr<Player>& player) {
+PlayerHandle Game::add_player(const shared_ptr<Player>& player) {
     if (player == nullptr) {
         throw NullPointerException("player");
     }
 
     check_player_can_be_added(player);
 
-    if (player->get_side() == TERRORIST) {
-        terrorist_player_count++;
+    Side side = player->get_side();
+    team(side).push_back(player);
+    if (player->is_alive()) {
+        alive_count(side)++;
+    }
+    scoreboard(side).add(player);
+
+    PlayerHandle player_id = players.size();
+    // Keyed by a view of the name, which lives as long as the player is kept in players
+    player_ids[player->get_name()] = player_id;
+    players.push_back(player);
+    player->set_observer(this);
+
+    if (storage == DENSE_PLAYER_ARRAYS) {
+        store.add(player->get_hp(), player->get_max_money(), player->get_money(), player->get_kills(),
+                  player->get_deaths(), side, player->get_entry_time());
     }
-    if (player->get_side() == COUNTER_TERRORIST) {
-        counter_terrorist_player_count++;
+    player->bind(storage == DENSE_PLAYER_ARRAYS ? &store : nullptr, player_id);
+
+    return player_id;
+}
+
+void Game::reset_players_and_add_money(Side side, uint money) {
+    if (storage == DENSE_PLAYER_ARRAYS) {
+        store.reset_hp_and_add_money(side, money);
+        alive_count(side) = team(side).size();
+        return;
+    }
+
+    for (const auto& player : team(side)) {
+        player->reset_hp();
+        player->add_money(money);
     }
-    players[player->get_name()] = player;
+}
+
+/// Replaces the contents of snapshot, so a buffer kept across rounds is reused without reallocating
+void Game::take_snapshot(string& snapshot) const {
+    snapshot.assign(GAME_SNAPSHOT_MAGIC, sizeof(GAME_SNAPSHOT_MAGIC));
+    append_varint(snapshot, GAME_SNAPSHOT_VERSION);
+    append_varint(snapshot, rounds);
+    append_varint(snapshot, round_length);
+    append_varint(snapshot, max_team_size);
+    append_varint(snapshot, current_round);
+    append_varint(snapshot, round_time);
+    append_varint(snapshot, ended);
+    append_varint(snapshot, players.size());
+
+    for (const auto& player : players) {
+        append_string(snapshot, player->get_name());
+        append_varint(snapshot, player->get_side());
+        append_varint(snapshot, player->get_entry_time());
+        append_varint(snapshot, player->get_max_money());
+        append_varint(snapshot, player->get_hp());
+        append_varint(snapshot, player->get_money());
+        append_varint(snapshot, player->get_kills());
+        append_varint(snapshot, player->get_deaths());
+
+        array<const Weapon*, 3> equipped_weapons = {player->find_weapon(MELEE), player->find_weapon(PISTOL),
+                                                    player->find_weapon(HEAVY)};
+        append_varint(snapshot, equipped_weapons.size() -
+                                count(equipped_weapons.begin(), equipped_weapons.end(), nullptr));
+        for (auto weapon : equipped_weapons) {
+            if (weapon != nullptr) {
+                append_string(snapshot, weapon->get_name());
+            }
+        }
+    }
+}
+
+/// Replaces the rounds, clock and players of this game with those of the snapshot. The id and player storage are kept.
+/// The snapshot is fully decoded and checked against the rules add_player enforces before anything is replaced, so a
+/// malformed one leaves the game untouched.
+/// Weapons are resolved by name in weapon_catalog, which the game pins in place of its current one.
+void Game::restore_snapshot(string_view snapshot, shared_ptr<const WeaponCatalog> weapon_catalog) {
+    if (snapshot.substr(0, sizeof(GAME_SNAPSHOT_MAGIC)) !=
+        string_view(GAME_SNAPSHOT_MAGIC, sizeof(GAME_SNAPSHOT_MAGIC))) {
+        throw invalid_argument("game snapshot has an invalid magic");
+    }
+    size_t position = sizeof(GAME_SNAPSHOT_MAGIC);
+    if (read_varint(snapshot, position) != GAME_SNAPSHOT_VERSION) {
+        throw invalid_argument("game snapshot version is not supported");
+    }
+
+    uint restored_rounds = read_varint(snapshot, position);
+    ull restored_round_length = read_varint(snapshot, position);
+    size_t restored_max_team_size = read_varint(snapshot, position);
+    uint restored_current_round = read_varint(snapshot, position);
+    ull restored_round_time = read_varint(snapshot, position);
+    bool restored_ended = read_varint(snapshot, position);
+    if (restored_rounds == 0 || restored_round_length == 0 || restored_max_team_size == 0 ||
+        restored_current_round == 0 || restored_current_round > restored_rounds) {
+        throw invalid_argument("game snapshot is inconsistent");
+    }
+
+    ull player_count = read_varint(snapshot, position);
+    vector<shared_ptr<Player>> restored_players;
+    restored_players.reserve(min<ull>(player_count, snapshot.size()));
+    unordered_set<string_view> restored_names;
+    size_t counter_terrorist_count = 0;
+    size_t terrorist_count = 0;
+    string name;
+    for (ull i = 0; i < player_count; i++) {
+        name = read_string(snapshot, position);
+        auto side = static_cast<Side>(read_varint(snapshot, position));
+        ull entry_time = read_varint(snapshot, position);
+        uint max_money = read_varint(snapshot, position);
+        uint hp = read_varint(snapshot, position);
+        uint money = read_varint(snapshot, position);
+        uint kills = read_varint(snapshot, position);
+        uint deaths = read_varint(snapshot, position);
+        if (side != COUNTER_TERRORIST && side != TERRORIST) {
+            throw invalid_argument("game snapshot has an invalid side");
+        }
+        if (++(side == COUNTER_TERRORIST ? counter_terrorist_count : terrorist_count) > restored_max_team_size) {
+            throw invalid_argument("game snapshot has a team larger than its max team size");
+        }
+
+        auto player = allocate_player(name, hp, max_money, money, side, entry_time);
+        player->restore_score(kills, deaths);
+        ull weapon_count = read_varint(snapshot, position);
+        for (ull j = 0; j < weapon_count; j++) {
+            name = read_string(snapshot, position);
+            auto weapon = weapon_catalog->find(name);
+            if (weapon == nullptr) {
+                throw invalid_argument("game snapshot refers to an unknown weapon: " + name);
+            }
+            player->equip_weapon(weapon.get());
+        }
+        // Views of the names of restored players, which are kept until the end
+        if (!restored_names.insert(player->get_name()).second) {
+            throw invalid_argument("game snapshot has a duplicate player name: " + player->get_name());
+        }
+        restored_players.push_back(std::move(player));
+    }
+    if (position != snapshot.size()) {
+        throw invalid_argument("game snapshot has trailing data");
+    }
+
+    remove_players();
+    catalog = std::move(weapon_catalog);
+    rounds = restored_rounds;
+    round_length = restored_round_length;
+    max_team_size = restored_max_team_size;
+    current_round = restored_current_round;
+    round_time = restored_round_time;
+    ended = restored_ended;
+    players.reserve(restored_players.size());
+    player_ids.reserve(restored_players.size());
+    if (storage == DENSE_PLAYER_ARRAYS) {
+        store.reserve(restored_players.size());
+    }
+    for (const auto& player : restored_players) {
+        add_player(player);
+    }
+}
+
+/// Sizes the teams, scoreboards and player lookups for team_size players a side up front. On a monotonic arena this
+/// also keeps them from leaving their outgrown buffers behind as they fill.
+void Game::reserve(size_t team_size) {
+    counter_terrorist_players.reserve(team_size);
+    terrorist_players.reserve(team_size);
+    counter_terrorist_scoreboard.reserve(team_size);
+    terrorist_scoreboard.reserve(team_size);
+    players.reserve(2 * team_size);
+    player_ids.reserve(2 * team_size);
+    if (storage == DENSE_PLAYER_ARRAYS) {
+        store.reserve(2 * team_size);
+    }
+}
+
+PlayerStorage Game::get_player_storage() const {
+    return storage;
+}
+
+pmr::memory_resource* Game::get_memory_resource() const {
+    return memory;
+}
+
+void Game::pin_catalog(shared_ptr<const WeaponCatalog> weapon_catalog) {
+    catalog = std::move(weapon_catalog);
+}
+
+const shared_ptr<const WeaponCatalog>& Game::get_pinned_catalog() const {
+    return catalog;
+}
+
+/// Every player of the game, whether created, restored from a snapshot or recovered from a journal, lives in its memory
+shared_ptr<Player> Game::allocate_player(string name, uint hp, uint max_money, uint money, Side side,
+                                         ull entry_time) const {
+    return allocate_shared<Player>(pmr::polymorphic_allocator<Player>(memory), std::move(name), hp, max_money, money,
+                                   side, entry_time);
+}
+
+void Game::on_player_died(const Player& player) {
+    alive_count(player.get_side())--;
+    scoreboard(player.get_side()).on_death_added(player);
+}
+
+void Game::on_player_revived(const Player& player) {
+    alive_count(player.get_side())++;
+}
+
+void Game::on_player_kill_added(const Player& player) {
+    scoreboard(player.get_side()).on_kill_added(player);
 }
 
 void Game::check_player_can_be_added(const shared_ptr<Player>& player) {
-    if (players.find(player->get_name()) != players.end()) {
+    if (player_ids.find(player->get_name()) != player_ids.end()) {
         handle_player_already_in_game(player);
     }
     if (is_team_full(player->get_side())) {
@@ -133,7 +403,7 @@ void Game::check_player_can_be_added(const shared_ptr<Player>& player) {
 }
 
 void Game::handle_player_already_in_game(const shared_ptr<Player>& player) {
-    auto old_player = players[player->get_name()];
+    auto old_player = players[player_ids.find(player->get_name())->second];
     if (old_player->get_side() == player->get_side()) {
         throw PlayerAlreadyInTeamException();
     }
@@ -143,11 +413,65 @@ void Game::handle_player_already_in_game(const shared_ptr<Player>& player) {
 }
 
 bool Game::is_team_full(Side side) const {
+    return get_team(side).size() >= max_team_size;
+}
+
+pmr::vector<shared_ptr<Player>>& Game::team(Side side) {
+    return const_cast<pmr::vector<shared_ptr<Player>>&>(get_team(side));
+}
+
+uint& Game::alive_count(Side side) {
+    if (side == TERRORIST) {
+        return terrorist_alive_count;
+    }
+    if (side == COUNTER_TERRORIST) {
+        return counter_terrorist_alive_count;
+    }
+    throw invalid_argument("side is invalid. should be one of: [COUNTER_TERRORIST, TERRORIST]");
+}
+
+const Scoreboard& Game::scoreboard(Side side) const {
     if (side == TERRORIST) {
-        return terrorist_player_count >= max_team_size;
+        return terrorist_scoreboard;
     }
     if (side == COUNTER_TERRORIST) {
-        return counter_terrorist_player_count >= max_team_size;
+        return counter_terrorist_scoreboard;
     }
     throw invalid_argument("side is invalid. should be one of: [COUNTER_TERRORIST, TERRORIST]");
-}
\ No newline at end of file
+}
+
+Scoreboard& Game::scoreboard(Side side) {
+    return const_cast<Scoreboard&>(static_cast<const Game*>(this)->scoreboard(side));
+}
+
+/// Full scan that the maintained alive counters are cross-checked against when built with CSXD_CHECK_INVARIANTS
+uint Game::count_alive_players(Side side) const {
+    if (storage == DENSE_PLAYER_ARRAYS) {
+        return store.count_alive(side);
+    }
+
+    uint player_count = 0;
+    for (const auto& player : players) {
+        if (side & player->get_side() && player->is_alive()) {
+            player_count++;
+        }
+    }
+    return player_count;
+}
+
+/// Detaches every player, which keeps its last state, and empties the teams, scoreboards and store
+void Game::remove_players() {
+    for (const auto& player : players) {
+        player->unbind();
+        player->set_observer(nullptr);
+    }
+    counter_terrorist_players.clear();
+    terrorist_players.clear();
+    counter_terrorist_alive_count = 0;
+    terrorist_alive_count = 0;
+    counter_terrorist_scoreboard = Scoreboard(memory);
+    terrorist_scoreboard = Scoreboard(memory);
+    player_ids.clear();
+    players.clear();
+    store = PlayerStore(memory);
+}
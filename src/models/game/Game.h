@@ -4,41 +4,85 @@
 
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "models/player/Player.h"
+#include "models/player/PlayerStore.h"
+#include "models/player/PlayerObserver.h"
+#include "PlayerStorage.h"
+#include "PlayerHandle.h"
+#include "Scoreboard.h"
+#include "utils/data/WeaponCatalog.h"
+#include "Mockable.h"
 
 using namespace std;
 
 typedef unsigned long long ull;
 
-class Game {
+/// Players, teams, scoreboards and the player store are allocated from memory, which must outlive the game and every
+/// player it allocated. A per-match monotonic arena makes all of it bump-allocated and released in one step.
+/// Players point to their weapons without owning them, so the game holds on to the catalog they were taken from, which
+/// GamePlay pins as it moves the match between versions. Weapons from any other catalog must outlive the game.
+class Game : public PlayerObserver {
 public:
-    Game(int id, uint rounds, ull round_length, size_t max_team_size);
-    virtual ~Game() = default;
-
-    virtual ull get_id() const;
-    virtual uint get_rounds() const;
-    virtual uint get_current_round() const;
-    virtual void go_next_round();
-    virtual ull get_round_length() const;
-    virtual ull get_round_time() const;
-    virtual void set_round_time(ull time);
-    virtual ull get_game_time() const;
-    virtual size_t get_max_team_size() const;
-    virtual void set_max_team_size(size_t size);
-    virtual void end();
-    virtual bool has_ended() const;
-    virtual vector<shared_ptr<Player>> get_all_players(Side side) const;
-    virtual shared_ptr<Player> get_player_by_name(const string& name);
-    virtual vector<shared_ptr<Player>> get_alive_players(Side side) const;
-    virtual uint get_alive_player_count(Side side) const;
-    virtual void add_player(const shared_ptr<Player>& player);
+    Game(int id, uint rounds, ull round_length, size_t max_team_size, PlayerStorage storage = PLAYER_OBJECTS,
+         pmr::memory_resource* memory = pmr::get_default_resource());
+    Game(const Game&) = delete;
+    Game& operator=(const Game&) = delete;
+    virtual ~Game();
+
+    CSXD_VIRTUAL ull get_id() const;
+    CSXD_VIRTUAL uint get_rounds() const;
+    CSXD_VIRTUAL uint get_current_round() const;
+    CSXD_VIRTUAL void go_next_round();
+    CSXD_VIRTUAL ull get_round_length() const;
+    CSXD_VIRTUAL ull get_round_time() const;
+    CSXD_VIRTUAL void set_round_time(ull time);
+    CSXD_VIRTUAL ull get_game_time() const;
+    CSXD_VIRTUAL size_t get_max_team_size() const;
+    CSXD_VIRTUAL void set_max_team_size(size_t size);
+    CSXD_VIRTUAL void end();
+    CSXD_VIRTUAL bool has_ended() const;
+    CSXD_VIRTUAL vector<shared_ptr<Player>> get_all_players(Side side) const;
+    CSXD_VIRTUAL const pmr::vector<shared_ptr<Player>>& get_team(Side side) const;
+    CSXD_VIRTUAL const pmr::vector<shared_ptr<Player>>& get_scoreboard(Side side) const;
+    CSXD_VIRTUAL shared_ptr<Player> get_player_by_name(const string& name);
+    CSXD_VIRTUAL shared_ptr<Player> find_player_by_name(const string& name);
+    CSXD_VIRTUAL shared_ptr<Player> get_player_by_handle(PlayerHandle handle) const;
+    CSXD_VIRTUAL shared_ptr<Player> find_player_by_handle(PlayerHandle handle) const;
+    CSXD_VIRTUAL PlayerHandle get_player_handle(const string& name) const;
+    const pmr::vector<shared_ptr<Player>>& get_players() const;
+    CSXD_VIRTUAL vector<shared_ptr<Player>> get_alive_players(Side side) const;
+    CSXD_VIRTUAL uint get_alive_player_count(Side side) const;
+    CSXD_VIRTUAL PlayerHandle add_player(const shared_ptr<Player>& player);
+    CSXD_VIRTUAL void reset_players_and_add_money(Side side, uint money);
+    CSXD_VIRTUAL void take_snapshot(string& snapshot) const;
+    CSXD_VIRTUAL void restore_snapshot(string_view snapshot, shared_ptr<const WeaponCatalog> weapon_catalog);
+    void reserve(size_t team_size);
+    PlayerStorage get_player_storage() const;
+    pmr::memory_resource* get_memory_resource() const;
+    void pin_catalog(shared_ptr<const WeaponCatalog> weapon_catalog);
+    const shared_ptr<const WeaponCatalog>& get_pinned_catalog() const;
+    shared_ptr<Player> allocate_player(string name, uint hp, uint max_money, uint money, Side side,
+                                       ull entry_time) const;
+
+    void on_player_died(const Player& player) override;
+    void on_player_revived(const Player& player) override;
+    void on_player_kill_added(const Player& player) override;
 
 protected:
     void check_player_can_be_added(const shared_ptr<Player>& player);
     void handle_player_already_in_game(const shared_ptr<Player>& player);
     bool is_team_full(Side side) const;
+    pmr::vector<shared_ptr<Player>>& team(Side side);
+    uint& alive_count(Side side);
+    const Scoreboard& scoreboard(Side side) const;
+    Scoreboard& scoreboard(Side side);
+    uint count_alive_players(Side side) const;
+    void remove_players();
 
     ull id;
     uint rounds;
@@ -47,9 +91,18 @@ protected:
     ull round_time;
     size_t max_team_size;
     bool ended;
-    uint counter_terrorist_player_count;
-    uint terrorist_player_count;
-    unordered_map<string, shared_ptr<Player>> players;
+    pmr::memory_resource* memory;
+    shared_ptr<const WeaponCatalog> catalog;
+    pmr::vector<shared_ptr<Player>> counter_terrorist_players;
+    pmr::vector<shared_ptr<Player>> terrorist_players;
+    uint counter_terrorist_alive_count;
+    uint terrorist_alive_count;
+    Scoreboard counter_terrorist_scoreboard;
+    Scoreboard terrorist_scoreboard;
+    PlayerStorage storage;
+    pmr::unordered_map<string_view, PlayerHandle> player_ids;
+    pmr::vector<shared_ptr<Player>> players;
+    PlayerStore store;
 };
 
 
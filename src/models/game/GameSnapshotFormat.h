@@ -0,0 +1,18 @@
+#ifndef CSXD_GAMESNAPSHOTFORMAT_H
+#define CSXD_GAMESNAPSHOTFORMAT_H
+
+
+/// Binary game snapshot layout. All integers are LEB128 varints, strings are a varint length followed by the bytes.
+///
+///   header:  "CSXS" magic, format version, rounds, round length, max team size, current round, round time,
+///            ended flag, player count
+///   player:  name, side, entry time, max money, hp, money, kills, deaths, equipped weapon count, weapon names
+///
+/// Players are stored in handle order, so a restored game hands out the same handles. Weapons are stored by name and
+/// resolved against the catalog when restoring.
+
+const char GAME_SNAPSHOT_MAGIC[] = {'C', 'S', 'X', 'S'};
+const unsigned GAME_SNAPSHOT_VERSION = 1;
+
+
+#endif //CSXD_GAMESNAPSHOTFORMAT_H
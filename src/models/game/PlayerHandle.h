@@ -0,0 +1,15 @@
+#ifndef CSXD_PLAYERHANDLE_H
+#define CSXD_PLAYERHANDLE_H
+
+
+#include <limits>
+#include <sys/types.h>
+
+/// Stable integer id a game gives a player when it is added, usable instead of the player's name
+typedef uint PlayerHandle;
+
+/// Handle that never refers to a player, so actions through it fail as for an unknown name
+const PlayerHandle NO_PLAYER = std::numeric_limits<PlayerHandle>::max();
+
+
+#endif //CSXD_PLAYERHANDLE_H
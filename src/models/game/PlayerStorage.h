@@ -0,0 +1,9 @@
+#ifndef CSXD_PLAYERSTORAGE_H
+#define CSXD_PLAYERSTORAGE_H
+
+enum PlayerStorage {
+    PLAYER_OBJECTS,
+    DENSE_PLAYER_ARRAYS
+};
+
+#endif //CSXD_PLAYERSTORAGE_H
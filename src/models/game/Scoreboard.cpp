@@ -0,0 +1,70 @@
+#include <algorithm>
+
+#include "Scoreboard.h"
+#include "utils/trace/Trace.h"
+
+Scoreboard::Scoreboard(pmr::memory_resource* memory) : players(memory) {
+}
+
+void Scoreboard::add(const shared_ptr<Player>& player) {
+    auto position = upper_bound(players.begin(), players.end(), player, comparer);
+    players.insert(position, player);
+}
+
+void Scoreboard::reserve(size_t capacity) {
+    players.reserve(capacity);
+}
+
+/// A kill can only move the player up, so it is rotated into place among the players above it
+void Scoreboard::on_kill_added(const Player& player) {
+    CSXD_TRACE_SPAN("scoreboard_reorder");
+    auto current = players.begin() + find(player, player.get_kills() - 1, player.get_deaths());
+    auto position = upper_bound(players.begin(), current, *current, comparer);
+    rotate(position, current, current + 1);
+}
+
+/// A death can only move the player down, so it is rotated into place among the players below it
+void Scoreboard::on_death_added(const Player& player) {
+    CSXD_TRACE_SPAN("scoreboard_reorder");
+    auto current = players.begin() + find(player, player.get_kills(), player.get_deaths() - 1);
+    auto position = upper_bound(current + 1, players.end(), *current, comparer);
+    rotate(current, current + 1, position);
+}
+
+const pmr::vector<shared_ptr<Player>>& Scoreboard::get_players() const {
+    return players;
+}
+
+bool Scoreboard::is_sorted() const {
+    return std::is_sorted(players.begin(), players.end(), comparer);
+}
+
+bool Scoreboard::comparer(const shared_ptr<Player>& p1, const shared_ptr<Player>& p2) {
+    return precedes(p1->get_kills(), p1->get_deaths(), p1->get_entry_time(),
+                    p2->get_kills(), p2->get_deaths(), p2->get_entry_time());
+}
+
+/// Binary searches with the player's key from before the change, which is where the player still sits.
+/// The player itself is skipped since its own getters already return the new key.
+size_t Scoreboard::find(const Player& player, uint old_kills, uint old_deaths) const {
+    ull entry_time = player.get_entry_time();
+    auto position = lower_bound(players.begin(), players.end(), &player,
+                                [&](const shared_ptr<Player>& other, const Player* moved) {
+        return other.get() != moved && precedes(other->get_kills(), other->get_deaths(), other->get_entry_time(),
+                        old_kills, old_deaths, entry_time);
+    });
+    while (position->get() != &player) {
+        position++;
+    }
+    return position - players.begin();
+}
+
+bool Scoreboard::precedes(uint kills1, uint deaths1, ull entry_time1, uint kills2, uint deaths2, ull entry_time2) {
+    if (kills1 != kills2) {
+        return kills1 > kills2;
+    }
+    if (deaths1 != deaths2) {
+        return deaths1 < deaths2;
+    }
+    return entry_time1 < entry_time2;
+}
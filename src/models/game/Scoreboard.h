@@ -0,0 +1,38 @@
+#ifndef CSXD_SCOREBOARD_H
+#define CSXD_SCOREBOARD_H
+
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "models/player/Player.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Players of one team kept in scoreboard order (kills desc, deaths asc, entry time asc).
+/// When a player's kills or deaths change, only that player is moved to its new position.
+class Scoreboard {
+public:
+    explicit Scoreboard(pmr::memory_resource* memory = pmr::get_default_resource());
+
+    void add(const shared_ptr<Player>& player);
+    void reserve(size_t capacity);
+    void on_kill_added(const Player& player);
+    void on_death_added(const Player& player);
+    const pmr::vector<shared_ptr<Player>>& get_players() const;
+    bool is_sorted() const;
+
+    static bool comparer(const shared_ptr<Player>& p1, const shared_ptr<Player>& p2);
+
+private:
+    size_t find(const Player& player, uint old_kills, uint old_deaths) const;
+    static bool precedes(uint kills1, uint deaths1, ull entry_time1, uint kills2, uint deaths2, ull entry_time2);
+
+    pmr::vector<shared_ptr<Player>> players;
+};
+
+
+#endif //CSXD_SCOREBOARD_H
@@ -1,3 +1,4 @@
+#include <stdexcept>
 #include <utility>
 
 #include "Player.h"
@@ -5,48 +6,65 @@
 #include "exceptions/NullPointerException.h"
 #include "exceptions/WeaponNotEquippedException.h"
 
-Player::Player(string name, uint initial_hp, uint max_money, uint initial_money, Side side, ull entry_time) : name(std::move(name)), hp(initial_hp), kills(0), deaths(0), max_money(max_money), money(initial_money), side(side), entry_time(entry_time), weapons() {
+Player::Player(string name, uint initial_hp, uint max_money, uint initial_money, Side side, ull entry_time) : name(std::move(name)), hp(initial_hp), kills(0), deaths(0), max_money(max_money), money(initial_money), side(side), entry_time(entry_time), weapons(), equipped_weapon_types(0), store(nullptr), id(0), observer(nullptr) {
     if (initial_hp > 100) {
         throw out_of_range("initial_hp should be between 0 and 100 (inclusive)");
     }
 }
 
 uint Player::get_hp() const {
-    return hp;
+    return hp_field();
 }
 
 void Player::add_hp(uint added_hp) {
-    hp = min(100u, hp + added_hp);
+    uint& current_hp = hp_field();
+    bool was_dead = current_hp == 0;
+    current_hp = min(100u, current_hp + added_hp);
+    if (was_dead && current_hp > 0 && observer != nullptr) {
+        observer->on_player_revived(*this);
+    }
 }
 
 void Player::take_damage(uint damage) {
-    if (hp == 0) {
+    uint& current_hp = hp_field();
+    if (current_hp == 0) {
         return;
     }
-    hp -= min(damage, hp);
-    if (hp == 0) {
-        deaths++;
+    current_hp -= min(damage, current_hp);
+    if (current_hp == 0) {
+        deaths_field()++;
+        if (observer != nullptr) {
+            observer->on_player_died(*this);
+        }
     }
 }
 
 void Player::reset_hp() {
-    hp = 100;
+    uint& current_hp = hp_field();
+    bool was_dead = current_hp == 0;
+    current_hp = 100;
+    if (was_dead && observer != nullptr) {
+        observer->on_player_revived(*this);
+    }
 }
 
 bool Player::is_alive() const {
-    return hp > 0;
+    return hp_field() > 0;
 }
 
 uint Player::get_kills() const {
-    return kills;
+    return kills_field();
 }
 
 void Player::add_kill() {
-    kills++;
+    kills_field()++;
+    if (observer != nullptr) {
+        observer->on_player_kill_added(*this);
+    }
 }
 
 uint Player::get_deaths() const {
-    return deaths;
+    return deaths_field();
 }
 
 uint Player::get_max_money() const {
@@ -54,18 +72,26 @@ uint Player::get_max_money() const {
 }
 
 uint Player::get_money() const {
-    return money;
+    return money_field();
 }
 
 void Player::add_money(uint amount) {
-    money = min(max_money, money + amount);
+    money_field() = min(max_money, money_field() + amount);
 }
 
 void Player::subtract_money(uint amount) {
-    if(amount > money) {
+    if(!try_subtract_money(amount)) {
         throw NotEnoughMoneyException();
     }
-    money -= amount;
+}
+
+bool Player::try_subtract_money(uint amount) {
+    uint& current_money = money_field();
+    if(amount > current_money) {
+        return false;
+    }
+    current_money -= amount;
+    return true;
 }
 
 ull Player::get_entry_time() const {
@@ -76,27 +102,120 @@ Side Player::get_side() const {
     return side;
 }
 
-string Player::get_name() const {
+const string& Player::get_name() const {
     return name;
 }
 
-shared_ptr<Weapon> Player::get_weapon(WeaponType type) {
-    if(weapons.find(type) == weapons.end()) {
+const Weapon* Player::get_weapon(WeaponType type) const {
+    auto weapon = find_weapon(type);
+    if(weapon == nullptr) {
         throw WeaponNotEquippedException();
     }
-    return weapons[type];
+    return weapon;
 }
 
-void Player::equip_weapon(shared_ptr<Weapon> weapon) {
+/// Slots of unequipped types are always null, so the lookup does not need to test the occupancy mask. Values that are
+/// not a WeaponType have no slot and are never equipped.
+const Weapon* Player::find_weapon(WeaponType type) const {
+    if (!is_weapon_type(type)) {
+        return nullptr;
+    }
+    return weapons[weapon_slot(type)];
+}
+
+/// The weapon is not owned by the player and must outlive it, as the weapons of the Data catalog do
+void Player::equip_weapon(const Weapon* weapon) {
     if (weapon == nullptr) {
         throw NullPointerException("weapon");
     }
-    weapons[weapon->get_type()] = std::move(weapon);
+    WeaponType type = weapon->get_type();
+    if (!is_weapon_type(type)) {
+        throw invalid_argument("weapon type is invalid. should be one of: [MELEE, PISTOL, HEAVY]");
+    }
+    weapons[weapon_slot(type)] = weapon;
+    equipped_weapon_types |= type;
 }
 
 void Player::drop_weapon(WeaponType type) {
-    if(weapons.find(type) == weapons.end()) {
+    if(!try_drop_weapon(type)) {
         throw WeaponNotEquippedException();
     }
-    weapons.erase(type);
+}
+
+bool Player::try_drop_weapon(WeaponType type) {
+    if (!is_weapon_type(type) || !(equipped_weapon_types & type)) {
+        return false;
+    }
+    weapons[weapon_slot(type)] = nullptr;
+    equipped_weapon_types &= ~type;
+    return true;
+}
+
+/// Sets kills and deaths without notifying the observer, for players rebuilt from a snapshot before joining a game
+void Player::restore_score(uint restored_kills, uint restored_deaths) {
+    kills_field() = restored_kills;
+    deaths_field() = restored_deaths;
+}
+
+/// The id is the player's handle in its game. While bound to a store, hp, money, kills and deaths live in the store's
+/// arrays instead of this object.
+void Player::bind(PlayerStore* player_store, uint player_id) {
+    store = player_store;
+    id = player_id;
+}
+
+uint Player::get_id() const {
+    return id;
+}
+
+void Player::unbind() {
+    if (store == nullptr) {
+        return;
+    }
+    hp = store->hp(id);
+    money = store->money(id);
+    kills = store->kills(id);
+    deaths = store->deaths(id);
+    store = nullptr;
+}
+
+void Player::set_observer(PlayerObserver* player_observer) {
+    observer = player_observer;
+}
+
+uint& Player::hp_field() {
+    return store == nullptr ? hp : store->hp(id);
+}
+
+uint Player::hp_field() const {
+    return store == nullptr ? hp : store->hp(id);
+}
+
+uint& Player::money_field() {
+    return store == nullptr ? money : store->money(id);
+}
+
+uint Player::money_field() const {
+    return store == nullptr ? money : store->money(id);
+}
+
+uint& Player::kills_field() {
+    return store == nullptr ? kills : store->kills(id);
+}
+
+uint Player::kills_field() const {
+    return store == nullptr ? kills : store->kills(id);
+}
+
+uint& Player::deaths_field() {
+    return store == nullptr ? deaths : store->deaths(id);
+}
+
+uint Player::deaths_field() const {
+    return store == nullptr ? deaths : store->deaths(id);
+}
+
+/// WeaponType values are the bit flags 1, 2 and 4, which shift down to the slots 0, 1 and 2
+size_t Player::weapon_slot(WeaponType type) {
+    return type >> 1;
 }
@@ -3,13 +3,16 @@
 
 
 #include <string>
-#include <unordered_map>
+#include <array>
 #include <memory>
 #include <utility>
 
 #include "Side.h"
+#include "PlayerStore.h"
+#include "PlayerObserver.h"
 #include "models/weapon/WeaponType.h"
 #include "models/weapon/Weapon.h"
+#include "Mockable.h"
 
 using namespace std;
 
@@ -20,26 +23,45 @@ public:
     Player(string name, uint initial_hp, uint max_money, uint initial_money, Side side, ull entry_time);
     virtual ~Player() = default;
 
-    virtual uint get_hp() const;
-    virtual void add_hp(uint added_hp);
-    virtual void take_damage(uint damage);
-    virtual void reset_hp();
-    virtual bool is_alive() const;
-    virtual uint get_kills() const;
-    virtual void add_kill();
-    virtual uint get_deaths() const;
-    virtual uint get_max_money() const;
-    virtual uint get_money() const;
-    virtual void add_money(uint amount);
-    virtual void subtract_money(uint amount);
-    virtual ull get_entry_time() const;
-    virtual Side get_side() const;
-    virtual string get_name() const;
-    virtual shared_ptr<Weapon> get_weapon(WeaponType type);
-    virtual void equip_weapon(shared_ptr<Weapon> weapon);
-    virtual void drop_weapon(WeaponType type);
+    CSXD_VIRTUAL uint get_hp() const;
+    CSXD_VIRTUAL void add_hp(uint added_hp);
+    CSXD_VIRTUAL void take_damage(uint damage);
+    CSXD_VIRTUAL void reset_hp();
+    CSXD_VIRTUAL bool is_alive() const;
+    CSXD_VIRTUAL uint get_kills() const;
+    CSXD_VIRTUAL void add_kill();
+    CSXD_VIRTUAL uint get_deaths() const;
+    CSXD_VIRTUAL uint get_max_money() const;
+    CSXD_VIRTUAL uint get_money() const;
+    CSXD_VIRTUAL void add_money(uint amount);
+    CSXD_VIRTUAL void subtract_money(uint amount);
+    CSXD_VIRTUAL bool try_subtract_money(uint amount);
+    CSXD_VIRTUAL ull get_entry_time() const;
+    CSXD_VIRTUAL Side get_side() const;
+    CSXD_VIRTUAL const string& get_name() const;
+    CSXD_VIRTUAL const Weapon* get_weapon(WeaponType type) const;
+    CSXD_VIRTUAL const Weapon* find_weapon(WeaponType type) const;
+    CSXD_VIRTUAL void equip_weapon(const Weapon* weapon);
+    CSXD_VIRTUAL void drop_weapon(WeaponType type);
+    CSXD_VIRTUAL bool try_drop_weapon(WeaponType type);
+
+    void restore_score(uint restored_kills, uint restored_deaths);
+    void bind(PlayerStore* player_store, uint player_id);
+    uint get_id() const;
+    void unbind();
+    void set_observer(PlayerObserver* player_observer);
 
 protected:
+    uint& hp_field();
+    uint hp_field() const;
+    uint& money_field();
+    uint money_field() const;
+    uint& kills_field();
+    uint kills_field() const;
+    uint& deaths_field();
+    uint deaths_field() const;
+    static size_t weapon_slot(WeaponType type);
+
     string name;
     uint hp;
     uint kills;
@@ -48,7 +70,11 @@ protected:
     uint money;
     ull entry_time;
     Side side;
-    unordered_map<WeaponType, shared_ptr<Weapon>> weapons;
+    array<const Weapon*, 3> weapons;
+    uint equipped_weapon_types;
+    PlayerStore* store;
+    uint id;
+    PlayerObserver* observer;
 };
 
 
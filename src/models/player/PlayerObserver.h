@@ -0,0 +1,17 @@
+#ifndef CSXD_PLAYEROBSERVER_H
+#define CSXD_PLAYEROBSERVER_H
+
+
+class Player;
+
+class PlayerObserver {
+public:
+    virtual ~PlayerObserver() = default;
+
+    virtual void on_player_died(const Player& player) = 0;
+    virtual void on_player_revived(const Player& player) = 0;
+    virtual void on_player_kill_added(const Player& player) = 0;
+};
+
+
+#endif //CSXD_PLAYEROBSERVER_H
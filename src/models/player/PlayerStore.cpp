@@ -0,0 +1,85 @@
+#include "PlayerStore.h"
+
+PlayerStore::PlayerStore(pmr::memory_resource* memory) : hps(memory), max_moneys(memory), moneys(memory), kill_counts(memory), death_counts(memory), sides(memory), entry_times(memory) {
+}
+
+uint PlayerStore::add(uint hp, uint max_money, uint money, uint kills, uint deaths, Side side, ull entry_time) {
+    hps.push_back(hp);
+    max_moneys.push_back(max_money);
+    moneys.push_back(money);
+    kill_counts.push_back(kills);
+    death_counts.push_back(deaths);
+    sides.push_back(side);
+    entry_times.push_back(entry_time);
+    return hps.size() - 1;
+}
+
+void PlayerStore::reserve(size_t capacity) {
+    hps.reserve(capacity);
+    max_moneys.reserve(capacity);
+    moneys.reserve(capacity);
+    kill_counts.reserve(capacity);
+    death_counts.reserve(capacity);
+    sides.reserve(capacity);
+    entry_times.reserve(capacity);
+}
+
+size_t PlayerStore::size() const {
+    return hps.size();
+}
+
+uint& PlayerStore::hp(uint id) {
+    return hps[id];
+}
+
+uint PlayerStore::hp(uint id) const {
+    return hps[id];
+}
+
+uint& PlayerStore::money(uint id) {
+    return moneys[id];
+}
+
+uint PlayerStore::money(uint id) const {
+    return moneys[id];
+}
+
+uint& PlayerStore::kills(uint id) {
+    return kill_counts[id];
+}
+
+uint PlayerStore::kills(uint id) const {
+    return kill_counts[id];
+}
+
+uint& PlayerStore::deaths(uint id) {
+    return death_counts[id];
+}
+
+uint PlayerStore::deaths(uint id) const {
+    return death_counts[id];
+}
+
+Side PlayerStore::side(uint id) const {
+    return sides[id];
+}
+
+ull PlayerStore::entry_time(uint id) const {
+    return entry_times[id];
+}
+
+uint PlayerStore::count_alive(Side side) const {
+    uint alive_count = 0;
+    for (size_t id = 0; id < hps.size(); id++) {
+        alive_count += (side & sides[id]) && hps[id] > 0;
+    }
+    return alive_count;
+}
+
+void PlayerStore::reset_hp_and_add_money(Side side, uint amount) {
+    reset_hp_and_add_money(side, amount, get_best_settlement_kernel());
+}
+
+void PlayerStore::reset_hp_and_add_money(Side side, uint amount, SettlementKernel kernel) {
+    settle_round(kernel, side, 100, amount, hps.size(), sides.data(), max_moneys.data(), hps.data(), moneys.data());
+}
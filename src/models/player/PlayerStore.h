@@ -0,0 +1,51 @@
+#ifndef CSXD_PLAYERSTORE_H
+#define CSXD_PLAYERSTORE_H
+
+
+#include <memory_resource>
+#include <vector>
+
+#include "Side.h"
+#include "SettlementKernel.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Structure-of-arrays storage for the numeric state of a game's players, indexed by player id
+class PlayerStore {
+public:
+    explicit PlayerStore(pmr::memory_resource* memory = pmr::get_default_resource());
+
+    uint add(uint hp, uint max_money, uint money, uint kills, uint deaths, Side side, ull entry_time);
+    void reserve(size_t capacity);
+    size_t size() const;
+
+    uint& hp(uint id);
+    uint hp(uint id) const;
+    uint& money(uint id);
+    uint money(uint id) const;
+    uint& kills(uint id);
+    uint kills(uint id) const;
+    uint& deaths(uint id);
+    uint deaths(uint id) const;
+    Side side(uint id) const;
+    ull entry_time(uint id) const;
+
+    uint count_alive(Side side) const;
+    /// Settles a round end over the whole store with the fastest kernel the CPU supports
+    void reset_hp_and_add_money(Side side, uint amount);
+    void reset_hp_and_add_money(Side side, uint amount, SettlementKernel kernel);
+
+private:
+    pmr::vector<uint> hps;
+    pmr::vector<uint> max_moneys;
+    pmr::vector<uint> moneys;
+    pmr::vector<uint> kill_counts;
+    pmr::vector<uint> death_counts;
+    pmr::vector<Side> sides;
+    pmr::vector<ull> entry_times;
+};
+
+
+#endif //CSXD_PLAYERSTORE_H
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "SettlementKernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CSXD_X86_SETTLEMENT_KERNELS
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(Side) == sizeof(uint), "the SIMD kernels load sides as 32-bit lanes");
+
+namespace {
+
+/// Also finishes the players after the last full vector of the SIMD kernels
+void settle_scalar(Side side, uint hp, uint amount, size_t begin, size_t count, const Side* sides,
+                   const uint* max_moneys, uint* hps, uint* moneys) {
+    for (size_t i = begin; i < count; i++) {
+        if (side & sides[i]) {
+            hps[i] = hp;
+            moneys[i] = min(max_moneys[i], moneys[i] + amount);
+        }
+    }
+}
+
+#ifdef CSXD_X86_SETTLEMENT_KERNELS
+
+/// Settles the four players from first. Credits wrap around before the unsigned min, exactly like the scalar
+/// min(max_money, money + amount), and lanes of the other side are blended back to their loaded values. Always inlined,
+/// so inside the AVX2 kernel it is VEX encoded too and does not pay for switching between SSE and AVX states.
+__attribute__((target("sse4.1"), always_inline))
+inline void settle_four(Side side, uint hp, uint amount, size_t first, const Side* sides, const uint* max_moneys,
+                        uint* hps, uint* moneys) {
+    __m128i player_sides = _mm_loadu_si128((const __m128i*) (sides + first));
+    __m128i skipped = _mm_cmpeq_epi32(_mm_and_si128(player_sides, _mm_set1_epi32(side)), _mm_setzero_si128());
+    __m128i player_hps = _mm_loadu_si128((const __m128i*) (hps + first));
+    __m128i player_moneys = _mm_loadu_si128((const __m128i*) (moneys + first));
+    __m128i player_max_moneys = _mm_loadu_si128((const __m128i*) (max_moneys + first));
+    __m128i credited_moneys = _mm_min_epu32(player_max_moneys, _mm_add_epi32(player_moneys, _mm_set1_epi32(amount)));
+    _mm_storeu_si128((__m128i*) (hps + first), _mm_blendv_epi8(_mm_set1_epi32(hp), player_hps, skipped));
+    _mm_storeu_si128((__m128i*) (moneys + first), _mm_blendv_epi8(credited_moneys, player_moneys, skipped));
+}
+
+__attribute__((target("sse4.1")))
+void settle_sse41(Side side, uint hp, uint amount, size_t count, const Side* sides, const uint* max_moneys,
+                  uint* hps, uint* moneys) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        settle_four(side, hp, amount, i, sides, max_moneys, hps, moneys);
+    }
+    settle_scalar(side, hp, amount, i, count, sides, max_moneys, hps, moneys);
+}
+
+/// A default match's 20 players leave four after the last full vector, so a half vector goes before the scalar loop
+__attribute__((target("avx2")))
+void settle_avx2(Side side, uint hp, uint amount, size_t count, const Side* sides, const uint* max_moneys,
+                 uint* hps, uint* moneys) {
+    const __m256i side_lanes = _mm256_set1_epi32(side);
+    const __m256i hp_lanes = _mm256_set1_epi32(hp);
+    const __m256i amount_lanes = _mm256_set1_epi32(amount);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i player_sides = _mm256_loadu_si256((const __m256i*) (sides + i));
+        __m256i skipped = _mm256_cmpeq_epi32(_mm256_and_si256(player_sides, side_lanes), zero);
+        __m256i player_hps = _mm256_loadu_si256((const __m256i*) (hps + i));
+        __m256i player_moneys = _mm256_loadu_si256((const __m256i*) (moneys + i));
+        __m256i player_max_moneys = _mm256_loadu_si256((const __m256i*) (max_moneys + i));
+        __m256i credited_moneys = _mm256_min_epu32(player_max_moneys, _mm256_add_epi32(player_moneys, amount_lanes));
+        _mm256_storeu_si256((__m256i*) (hps + i), _mm256_blendv_epi8(hp_lanes, player_hps, skipped));
+        _mm256_storeu_si256((__m256i*) (moneys + i), _mm256_blendv_epi8(credited_moneys, player_moneys, skipped));
+    }
+    if (i + 4 <= count) {
+        settle_four(side, hp, amount, i, sides, max_moneys, hps, moneys);
+        i += 4;
+    }
+    settle_scalar(side, hp, amount, i, count, sides, max_moneys, hps, moneys);
+}
+
+#endif
+
+SettlementKernel detect_best_settlement_kernel() {
+    if (is_settlement_kernel_supported(AVX2_KERNEL)) {
+        return AVX2_KERNEL;
+    }
+    if (is_settlement_kernel_supported(SSE41_KERNEL)) {
+        return SSE41_KERNEL;
+    }
+    return SCALAR_KERNEL;
+}
+
+}
+
+bool is_settlement_kernel_supported(SettlementKernel kernel) {
+    switch (kernel) {
+        case SCALAR_KERNEL:
+            return true;
+#ifdef CSXD_X86_SETTLEMENT_KERNELS
+        case SSE41_KERNEL:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1");
+        case AVX2_KERNEL:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+SettlementKernel get_best_settlement_kernel() {
+    static const SettlementKernel best_kernel = detect_best_settlement_kernel();
+    return best_kernel;
+}
+
+void settle_round(SettlementKernel kernel, Side side, uint hp, uint amount, size_t count, const Side* sides,
+                  const uint* max_moneys, uint* hps, uint* moneys) {
+    switch (kernel) {
+        case SCALAR_KERNEL: {
+            settle_scalar(side, hp, amount, 0, count, sides, max_moneys, hps, moneys);
+            return;
+        }
+#ifdef CSXD_X86_SETTLEMENT_KERNELS
+        case SSE41_KERNEL: {
+            settle_sse41(side, hp, amount, count, sides, max_moneys, hps, moneys);
+            return;
+        }
+        case AVX2_KERNEL: {
+            settle_avx2(side, hp, amount, count, sides, max_moneys, hps, moneys);
+            return;
+        }
+#endif
+        default: {
+            throw invalid_argument("kernel is not available on this platform");
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef CSXD_SETTLEMENTKERNEL_H
+#define CSXD_SETTLEMENTKERNEL_H
+
+
+#include <cstddef>
+
+#include "Side.h"
+
+using namespace std;
+
+/// Instruction sets the round-end settlement can run on. The SIMD kernels are compiled for their instruction set
+/// whatever the build flags, and only used once the CPU is known to support it.
+enum SettlementKernel {
+    SCALAR_KERNEL,
+    SSE41_KERNEL,
+    AVX2_KERNEL
+};
+
+bool is_settlement_kernel_supported(SettlementKernel kernel);
+/// The fastest kernel this CPU supports, detected once
+SettlementKernel get_best_settlement_kernel();
+
+/// Resets the hp of every player of side to hp and credits them amount, capped at their max money as
+/// Player::add_money does. The arrays hold count players indexed alike. kernel must be supported by this CPU.
+void settle_round(SettlementKernel kernel, Side side, uint hp, uint amount, size_t count, const Side* sides,
+                  const uint* max_moneys, uint* hps, uint* moneys);
+
+
+#endif //CSXD_SETTLEMENTKERNEL_H
@@ -1,6 +1,8 @@
 #ifndef CSXD_SIDE_H
 #define CSXD_SIDE_H
 
+#include <sys/types.h>
+
 #include "nlohmann/json.hpp"
 
 enum Side {
@@ -9,6 +11,11 @@ enum Side {
     ALL = 3
 };
 
+/// Whether value is the side of one team, for sides that come from bytes or callers rather than the text parser
+inline bool is_team_side(uint value) {
+    return value == COUNTER_TERRORIST || value == TERRORIST;
+}
+
 NLOHMANN_JSON_SERIALIZE_ENUM(Side, {
     {COUNTER_TERRORIST, "counter_terrorist"},
     {TERRORIST, "terrorist"},
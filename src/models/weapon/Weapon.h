@@ -8,6 +8,7 @@
 
 #include "WeaponType.h"
 #include "models/player/Side.h"
+#include "Mockable.h"
 
 using namespace std;
 using json = nlohmann::json;
@@ -18,12 +19,12 @@ public:
     Weapon(string name, uint price, uint damage_per_hit, uint money_per_kill, WeaponType type, Side available_for);
     virtual ~Weapon() = default;
 
-    virtual string get_name() const;
-    virtual uint get_price() const;
-    virtual uint get_damage_per_hit() const;
-    virtual uint get_money_per_kill() const;
-    virtual WeaponType get_type() const;
-    virtual bool is_available_for(Side side) const;
+    CSXD_VIRTUAL string get_name() const;
+    CSXD_VIRTUAL uint get_price() const;
+    CSXD_VIRTUAL uint get_damage_per_hit() const;
+    CSXD_VIRTUAL uint get_money_per_kill() const;
+    CSXD_VIRTUAL WeaponType get_type() const;
+    CSXD_VIRTUAL bool is_available_for(Side side) const;
 
     friend void to_json(nlohmann::json& json, const Weapon& weapon);
     friend void from_json(const nlohmann::json& json, Weapon& weapon);
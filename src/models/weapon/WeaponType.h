@@ -1,6 +1,8 @@
 #ifndef CSXD_WEAPONTYPE_H
 #define CSXD_WEAPONTYPE_H
 
+#include <sys/types.h>
+
 #include "nlohmann/json.hpp"
 
 enum WeaponType {
@@ -9,6 +11,11 @@ enum WeaponType {
     HEAVY = 4
 };
 
+/// Whether value is one of the enumerators, for types that come from bytes or callers rather than the text parser
+inline bool is_weapon_type(uint value) {
+    return value == MELEE || value == PISTOL || value == HEAVY;
+}
+
 NLOHMANN_JSON_SERIALIZE_ENUM(WeaponType, {
     {MELEE, "melee"},
     {PISTOL, "pistol"},
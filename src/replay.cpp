@@ -0,0 +1,84 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "utils/data/Data.h"
+#include "server/BulkReplayer.h"
+
+namespace {
+
+void print_usage(const char* program) {
+    cerr << "usage: " << program << " [-j workers] [-o output_directory] [-w weapons.json] <directory|manifest>" << endl;
+}
+
+/// 0 unless text is a whole positive number
+size_t parse_worker_count(const string& text) {
+    try {
+        size_t parsed_size;
+        unsigned long worker_count = stoul(text, &parsed_size);
+        return parsed_size == text.size() && text[0] != '-' ? worker_count : 0;
+    }
+    catch (const logic_error&) {
+        return 0;
+    }
+}
+
+}
+
+/// Replays every match of a directory, or every match listed by a manifest file, and reports the throughput.
+/// Usage: CSxDReplay [-j workers] [-o output_directory] [-w weapons.json] <directory|manifest>
+int main(int argc, char* argv[]) {
+    size_t worker_count = max(1u, thread::hardware_concurrency());
+    string output_directory = "replay_output";
+    string weapons_path;
+    string source;
+    for (int i = 1; i < argc; i++) {
+        string argument = argv[i];
+        if ((argument == "-j" || argument == "--jobs") && i + 1 < argc) {
+            worker_count = parse_worker_count(argv[++i]);
+            if (worker_count == 0) {
+                print_usage(argv[0]);
+                return 2;
+            }
+        }
+        else if ((argument == "-o" || argument == "--output") && i + 1 < argc) {
+            output_directory = argv[++i];
+        }
+        else if ((argument == "-w" || argument == "--weapons") && i + 1 < argc) {
+            weapons_path = argv[++i];
+        }
+        else {
+            source = argument;
+        }
+    }
+
+    if (source.empty()) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    if (weapons_path.empty()) {
+        Data::load();
+    }
+    else {
+        Data::load(weapons_path);
+    }
+
+    auto paths = filesystem::is_directory(source) ? BulkReplayer::list_directory(source)
+                                                   : BulkReplayer::read_manifest(source);
+
+    BulkReplayer replayer(worker_count, output_directory);
+    auto stats = replayer.replay(paths);
+
+    ofstream summary(filesystem::path(output_directory) / "summary.tsv");
+    replayer.write_summaries(summary);
+
+    cout << stats.matches << " matches (" << stats.failed_matches << " failed), " << stats.commands << " commands in "
+         << stats.seconds << " s on " << worker_count << " workers: " << stats.matches_per_second() << " matches/s, "
+         << stats.commands_per_second() << " commands/s" << endl;
+
+    return stats.failed_matches == 0 ? 0 : 1;
+}
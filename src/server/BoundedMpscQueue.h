@@ -0,0 +1,95 @@
+#ifndef CSXD_BOUNDEDMPSCQUEUE_H
+#define CSXD_BOUNDEDMPSCQUEUE_H
+
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/// Bounded lock-free queue for many producer threads and a single consumer thread. Every slot carries a sequence
+/// number that tells whose turn it is: producers claim a position with one compare-and-swap and publish the value by
+/// bumping the slot's sequence, the consumer takes values in position order without any read-modify-write. Pushing
+/// into a full queue fails instead of waiting, so a producer decides itself whether to retry or drop.
+template <typename T>
+class BoundedMpscQueue {
+public:
+    /// The capacity is rounded up to a power of two
+    explicit BoundedMpscQueue(size_t capacity) : slots(), mask(0), enqueue_position(0), dequeue_position(0) {
+        if (capacity == 0) {
+            throw out_of_range("capacity should be more than 0");
+        }
+        size_t rounded_capacity = 1;
+        while (rounded_capacity < capacity) {
+            rounded_capacity <<= 1;
+        }
+        slots = make_unique<Slot[]>(rounded_capacity);
+        for (size_t i = 0; i < rounded_capacity; i++) {
+            slots[i].sequence.store(i, memory_order_relaxed);
+        }
+        mask = rounded_capacity - 1;
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+    /// Safe to call from any thread. Returns false, leaving value untouched, if the queue is full.
+    bool try_push(T& value) {
+        size_t position = enqueue_position.load(memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[position & mask];
+            size_t sequence = slot->sequence.load(memory_order_acquire);
+            auto difference = (ptrdiff_t) sequence - (ptrdiff_t) position;
+            if (difference == 0) {
+                if (enqueue_position.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (difference < 0) {
+                return false;
+            }
+            else {
+                position = enqueue_position.load(memory_order_relaxed);
+            }
+        }
+
+        slot->value = std::move(value);
+        slot->sequence.store(position + 1, memory_order_release);
+        return true;
+    }
+
+    /// Only for the consumer thread. Returns false if no pushed value is ready.
+    bool try_pop(T& value) {
+        Slot& slot = slots[dequeue_position & mask];
+        if (slot.sequence.load(memory_order_acquire) != dequeue_position + 1) {
+            return false;
+        }
+
+        value = std::move(slot.value);
+        slot.sequence.store(dequeue_position + mask + 1, memory_order_release);
+        dequeue_position++;
+        return true;
+    }
+
+    size_t get_capacity() const {
+        return mask + 1;
+    }
+
+private:
+    /// Slots sit on their own cache lines, so producers filling neighbouring slots do not contend
+    struct alignas(64) Slot {
+        atomic<size_t> sequence;
+        T value;
+    };
+
+    unique_ptr<Slot[]> slots;
+    size_t mask;
+    alignas(64) atomic<size_t> enqueue_position;
+    alignas(64) size_t dequeue_position;
+};
+
+
+#endif //CSXD_BOUNDEDMPSCQUEUE_H
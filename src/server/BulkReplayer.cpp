@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "BulkReplayer.h"
+#include "WorkStealingPool.h"
+#include "utils/matchlog/MatchLogFormat.h"
+#include "utils/parser/MappedFile.h"
+#include "utils/memory/MatchArena.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+#include "MatchLogReplayer.h"
+
+namespace {
+
+bool is_binary_match_log(string_view contents) {
+    return contents.substr(0, sizeof(MATCH_LOG_MAGIC)) == string_view(MATCH_LOG_MAGIC, sizeof(MATCH_LOG_MAGIC));
+}
+
+}
+
+double BulkReplayStats::matches_per_second() const {
+    return seconds > 0 ? matches / seconds : 0;
+}
+
+double BulkReplayStats::commands_per_second() const {
+    return seconds > 0 ? commands / seconds : 0;
+}
+
+BulkReplayer::BulkReplayer(size_t worker_count, string output_directory) : worker_count(worker_count), output_directory(std::move(output_directory)), summaries() {
+    if (worker_count == 0) {
+        throw out_of_range("worker_count should be more than 0");
+    }
+}
+
+/// Each match writes only its own summary, so the summaries need no locking
+BulkReplayStats BulkReplayer::replay(const vector<string>& paths) {
+    filesystem::create_directories(output_directory);
+
+    summaries.assign(paths.size(), MatchSummary());
+    for (size_t i = 0; i < paths.size(); i++) {
+        summaries[i].path = paths[i];
+        summaries[i].output_path = (filesystem::path(output_directory) /
+                                    (to_string(i) + "-" + filesystem::path(paths[i]).filename().string() + ".out")).string();
+    }
+
+    auto started_at = chrono::steady_clock::now();
+    {
+        WorkStealingPool pool(worker_count);
+        for (auto& summary : summaries) {
+            pool.submit([this, &summary] { replay_match(summary); });
+        }
+        pool.wait();
+    }
+
+    BulkReplayStats stats = {};
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - started_at).count();
+    for (const auto& summary : summaries) {
+        stats.matches++;
+        stats.failed_matches += summary.failed;
+        stats.commands += summary.commands;
+    }
+    return stats;
+}
+
+const vector<MatchSummary>& BulkReplayer::get_summaries() const {
+    return summaries;
+}
+
+/// One tab-separated line per match, after a header line
+void BulkReplayer::write_summaries(ostream& stream) const {
+    stream << "path\tstatus\tcommands\tcounter_terrorist_round_wins\tterrorist_round_wins\tseconds\n";
+    for (const auto& summary : summaries) {
+        stream << summary.path << '\t' << (summary.failed ? "failed: " + summary.error : "ok") << '\t'
+               << summary.commands << '\t' << summary.counter_terrorist_round_wins << '\t'
+               << summary.terrorist_round_wins << '\t' << summary.seconds << '\n';
+    }
+}
+
+/// Regular files of the directory, sorted by path so that summaries come out in a stable order
+vector<string> BulkReplayer::list_directory(const string& path) {
+    vector<string> paths;
+    for (const auto& entry : filesystem::directory_iterator(path)) {
+        if (entry.is_regular_file()) {
+            paths.push_back(entry.path().string());
+        }
+    }
+    sort(paths.begin(), paths.end());
+    return paths;
+}
+
+/// One log path per line. Relative paths are relative to the manifest's directory, empty lines are skipped.
+vector<string> BulkReplayer::read_manifest(const string& path) {
+    ifstream manifest(path);
+    if (!manifest) {
+        throw invalid_argument("manifest can not be opened: " + path);
+    }
+
+    auto directory = filesystem::path(path).parent_path();
+    vector<string> paths;
+    string line;
+    while (getline(manifest, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            continue;
+        }
+        filesystem::path log_path(line);
+        paths.push_back((log_path.is_absolute() ? log_path : directory / log_path).string());
+    }
+    return paths;
+}
+
+/// A match whose output can not be opened or written fails like one whose log can not be read
+void BulkReplayer::replay_match(MatchSummary& summary) const {
+    auto started_at = chrono::steady_clock::now();
+    try {
+        MappedFile log(summary.path);
+        ofstream output(summary.output_path);
+        if (!output.is_open()) {
+            throw runtime_error("could not open " + summary.output_path);
+        }
+
+        if (is_binary_match_log(log.get_contents())) {
+            MatchLogReplayer replayer(log.get_contents(), output);
+            replayer.replay();
+            summary.commands = replayer.get_command_count();
+            summary.counter_terrorist_round_wins = replayer.get_round_wins(COUNTER_TERRORIST);
+            summary.terrorist_round_wins = replayer.get_round_wins(TERRORIST);
+        }
+        else {
+            MatchArena arena;
+            Interactions interactions;
+            interactions.set_input_buffer(log.get_contents());
+            interactions.set_output_stream(output);
+            interactions.init();
+            interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds(), DENSE_PLAYER_ARRAYS, &arena));
+            interactions.begin();
+            summary.commands = interactions.get_command_count();
+            summary.counter_terrorist_round_wins = interactions.get_round_wins(COUNTER_TERRORIST);
+            summary.terrorist_round_wins = interactions.get_round_wins(TERRORIST);
+        }
+        if (!output.flush()) {
+            throw runtime_error("could not write " + summary.output_path);
+        }
+        summary.failed = false;
+    }
+    catch (const exception& ex) {
+        summary.failed = true;
+        summary.error = ex.what();
+    }
+    summary.seconds = chrono::duration<double>(chrono::steady_clock::now() - started_at).count();
+}
@@ -0,0 +1,58 @@
+#ifndef CSXD_BULKREPLAYER_H
+#define CSXD_BULKREPLAYER_H
+
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+struct MatchSummary {
+    string path;
+    string output_path;
+    bool failed;
+    string error;
+    ull commands;
+    uint counter_terrorist_round_wins;
+    uint terrorist_round_wins;
+    double seconds;
+};
+
+struct BulkReplayStats {
+    ull matches;
+    ull failed_matches;
+    ull commands;
+    double seconds;
+
+    double matches_per_second() const;
+    double commands_per_second() const;
+};
+
+/// Replays archived matches, textual or binary match logs, on a WorkStealingPool. Every match writes its output to
+/// <output_directory>/<index>-<log file name>.out, where index is the log's position in the replayed paths, so logs of
+/// the same name in different directories never share an output. The weapon catalog must be loaded before and is only
+/// read while replaying.
+class BulkReplayer {
+public:
+    BulkReplayer(size_t worker_count, string output_directory);
+
+    BulkReplayStats replay(const vector<string>& paths);
+    const vector<MatchSummary>& get_summaries() const;
+    void write_summaries(ostream& stream) const;
+
+    static vector<string> list_directory(const string& path);
+    static vector<string> read_manifest(const string& path);
+
+private:
+    void replay_match(MatchSummary& summary) const;
+
+    size_t worker_count;
+    string output_directory;
+    vector<MatchSummary> summaries;
+};
+
+
+#endif //CSXD_BULKREPLAYER_H
@@ -0,0 +1,214 @@
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "MatchHost.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+#include "utils/memory/MatchArena.h"
+
+double MatchHostStats::matches_per_second() const {
+    return seconds > 0 ? matches / seconds : 0;
+}
+
+double MatchHostStats::commands_per_second() const {
+    return seconds > 0 ? commands / seconds : 0;
+}
+
+class MatchHost::Worker {
+public:
+    Worker() : finished_matches(0), failed_matches(0), commands(0), latencies(), outcomes(), pending_matches(0), stopping(false) {
+        thread = std::thread(&Worker::run, this);
+    }
+
+    ~Worker() {
+        {
+            lock_guard<mutex> lock(inbox_mutex);
+            stopping = true;
+        }
+        inbox_changed.notify_one();
+        thread.join();
+    }
+
+    void submit(string_view input, ostream& output) {
+        {
+            lock_guard<mutex> lock(inbox_mutex);
+            inbox.emplace_back(input, &output);
+            pending_matches++;
+        }
+        inbox_changed.notify_one();
+    }
+
+    void wait() {
+        unique_lock<mutex> lock(inbox_mutex);
+        all_matches_ended.wait(lock, [this] { return pending_matches == 0; });
+    }
+
+    atomic<ull> finished_matches;
+    atomic<ull> failed_matches;
+    atomic<ull> commands;
+    CommandLatencies latencies;
+    /// Per OutcomeCounters row and outcome. Only ever added to, so they are read without stopping the worker.
+    array<atomic<ull>, OutcomeCounters::ROW_COUNT * OutcomeCounters::OUTCOME_COUNT> outcomes;
+
+private:
+    /// The arena is declared first so it outlives everything the match allocated from it
+    struct Match {
+        MatchArena arena;
+        Interactions interactions;
+    };
+
+    void run() {
+        vector<unique_ptr<Match>> matches;
+        vector<pair<string_view, ostream*>> new_matches;
+
+        while (true) {
+            {
+                unique_lock<mutex> lock(inbox_mutex);
+                inbox_changed.wait(lock, [&] { return stopping || !inbox.empty() || !matches.empty(); });
+                if (stopping && inbox.empty() && matches.empty()) {
+                    return;
+                }
+                new_matches.swap(inbox);
+            }
+
+            for (const auto& new_match : new_matches) {
+                start_match(matches, new_match.first, *new_match.second);
+            }
+            new_matches.clear();
+
+            for (size_t i = 0; i < matches.size();) {
+                if (play_round(matches[i]->interactions)) {
+                    i++;
+                    continue;
+                }
+                matches[i] = std::move(matches.back());
+                matches.pop_back();
+            }
+        }
+    }
+
+    void start_match(vector<unique_ptr<Match>>& matches, string_view input, ostream& output) {
+        try {
+            auto match = make_unique<Match>();
+            Interactions& interactions = match->interactions;
+            interactions.set_input_buffer(input);
+            interactions.set_output_stream(output);
+            interactions.set_latencies(&latencies);
+            interactions.init();
+            interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds(), DENSE_PLAYER_ARRAYS,
+                                                             &match->arena));
+            matches.push_back(std::move(match));
+        }
+        catch (...) {
+            failed_matches++;
+            match_ended();
+        }
+    }
+
+    /// Returns whether the match is still running
+    bool play_round(Interactions& interactions) {
+        try {
+            interactions.play_round();
+            if (!interactions.has_ended()) {
+                return true;
+            }
+            finished_matches++;
+        }
+        catch (...) {
+            failed_matches++;
+        }
+        commands += interactions.get_command_count();
+        add_outcomes(interactions.get_outcomes());
+        match_ended();
+        return false;
+    }
+
+    void add_outcomes(const OutcomeCounters& match_outcomes) {
+        for (size_t row = 0; row < OutcomeCounters::ROW_COUNT; row++) {
+            for (size_t outcome = 0; outcome < OutcomeCounters::OUTCOME_COUNT; outcome++) {
+                ull count = match_outcomes.get(row, (CommandOutcome) outcome);
+                if (count > 0) {
+                    outcomes[row * OutcomeCounters::OUTCOME_COUNT + outcome].fetch_add(count, memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    void match_ended() {
+        lock_guard<mutex> lock(inbox_mutex);
+        if (--pending_matches == 0) {
+            all_matches_ended.notify_all();
+        }
+    }
+
+    std::thread thread;
+    mutex inbox_mutex;
+    condition_variable inbox_changed;
+    condition_variable all_matches_ended;
+    vector<pair<string_view, ostream*>> inbox;
+    size_t pending_matches;
+    bool stopping;
+};
+
+MatchHost::MatchHost(size_t worker_count) : workers(), next_worker(0), started_at(chrono::steady_clock::now()) {
+    if (worker_count == 0) {
+        throw out_of_range("worker_count should be more than 0");
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        workers.push_back(make_unique<Worker>());
+    }
+}
+
+MatchHost::~MatchHost() = default;
+
+void MatchHost::submit(string_view input, ostream& output) {
+    workers[next_worker]->submit(input, output);
+    next_worker = (next_worker + 1) % workers.size();
+}
+
+void MatchHost::wait() {
+    for (const auto& worker : workers) {
+        worker->wait();
+    }
+}
+
+MatchHostStats MatchHost::get_stats() const {
+    MatchHostStats stats {0, 0, 0, 0};
+    for (const auto& worker : workers) {
+        stats.matches += worker->finished_matches;
+        stats.failed_matches += worker->failed_matches;
+        stats.commands += worker->commands;
+    }
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - started_at).count();
+    return stats;
+}
+
+CommandLatencies MatchHost::get_latencies() const {
+    CommandLatencies latencies;
+    for (const auto& worker : workers) {
+        latencies.merge(worker->latencies);
+    }
+    return latencies;
+}
+
+OutcomeCounters MatchHost::get_outcomes() const {
+    OutcomeCounters outcomes;
+    for (const auto& worker : workers) {
+        for (size_t row = 0; row < OutcomeCounters::ROW_COUNT; row++) {
+            for (size_t outcome = 0; outcome < OutcomeCounters::OUTCOME_COUNT; outcome++) {
+                ull count = worker->outcomes[row * OutcomeCounters::OUTCOME_COUNT + outcome].load(memory_order_relaxed);
+                outcomes.add(row, (CommandOutcome) outcome, count);
+            }
+        }
+    }
+    return outcomes;
+}
+
+size_t MatchHost::get_worker_count() const {
+    return workers.size();
+}
@@ -0,0 +1,58 @@
+#ifndef CSXD_MATCHHOST_H
+#define CSXD_MATCHHOST_H
+
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "utils/metrics/CommandLatencies.h"
+#include "utils/metrics/OutcomeCounters.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+struct MatchHostStats {
+    ull matches;
+    ull failed_matches;
+    ull commands;
+    double seconds;
+
+    double matches_per_second() const;
+    double commands_per_second() const;
+};
+
+/// Runs many matches on a fixed set of worker threads. Every match is pinned to one worker for its whole lifetime, so
+/// its Interactions, GamePlay and Game are only ever touched by that thread and need no locking. A worker interleaves
+/// its matches one round at a time and times their commands into its own latency histograms. Each match is allocated
+/// from its own arena, released in one step when it ends.
+class MatchHost {
+public:
+    explicit MatchHost(size_t worker_count);
+    MatchHost(const MatchHost&) = delete;
+    MatchHost& operator=(const MatchHost&) = delete;
+    ~MatchHost();
+
+    /// input must stay alive and output must not be used elsewhere until the match has ended
+    void submit(string_view input, ostream& output);
+    void wait();
+    MatchHostStats get_stats() const;
+    /// The command latencies of all workers merged; only consistent once wait() has returned
+    CommandLatencies get_latencies() const;
+    /// The outcome counters of all ended matches added up; safe to call while matches are running
+    OutcomeCounters get_outcomes() const;
+    size_t get_worker_count() const;
+
+private:
+    class Worker;
+
+    vector<unique_ptr<Worker>> workers;
+    size_t next_worker;
+    chrono::steady_clock::time_point started_at;
+};
+
+
+#endif //CSXD_MATCHHOST_H
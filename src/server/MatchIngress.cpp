@@ -0,0 +1,90 @@
+#include "MatchIngress.h"
+
+MatchIngress::MatchIngress(Interactions& interactions, size_t capacity) : queue(capacity), interactions(interactions), drained_command(), player_handles() {
+}
+
+/// Safe to call from any thread. Returns false, leaving command untouched, if the queue is full.
+bool MatchIngress::try_submit(IngressCommand& command) {
+    return queue.try_push(command);
+}
+
+/// Only for the worker that owns the match. Executes up to max_commands queued commands and returns how many it did.
+size_t MatchIngress::drain(size_t max_commands) {
+    size_t drained = 0;
+    while (drained < max_commands && queue.try_pop(drained_command)) {
+        execute(drained_command);
+        drained++;
+    }
+    return drained;
+}
+
+size_t MatchIngress::get_capacity() const {
+    return queue.get_capacity();
+}
+
+void MatchIngress::execute(const IngressCommand& command) {
+    if (command.rejected || !has_valid_arguments(command)) {
+        interactions.reject(command.time);
+        return;
+    }
+
+    switch (command.command) {
+        case ADD_USER: {
+            PlayerHandle handle = interactions.add_user(command.player, command.side, command.time);
+            if (handle != NO_PLAYER) {
+                player_handles.emplace(command.player, handle);
+            }
+            break;
+        }
+        case GET_HEALTH: {
+            interactions.get_health(player_handle(command.player), command.time);
+            break;
+        }
+        case GET_MONEY: {
+            interactions.get_money(player_handle(command.player), command.time);
+            break;
+        }
+        case BUY: {
+            interactions.buy(player_handle(command.player),
+                             interactions.get_game_play()->try_get_weapon_by_name(command.weapon), command.time);
+            break;
+        }
+        case TAP: {
+            interactions.tap(player_handle(command.player), player_handle(command.other_player), command.weapon_type,
+                             command.time);
+            break;
+        }
+        case SCORE_BOARD: {
+            interactions.scoreboard(command.time);
+            break;
+        }
+    }
+}
+
+/// Commands are built by connection threads, so values that are not enumerators are rejected here, as the text parser
+/// rejects an unknown command, side or weapon type
+bool MatchIngress::has_valid_arguments(const IngressCommand& command) {
+    switch (command.command) {
+        case ADD_USER: {
+            return is_team_side(command.side);
+        }
+        case TAP: {
+            return is_weapon_type(command.weapon_type);
+        }
+        case GET_HEALTH:
+        case GET_MONEY:
+        case BUY:
+        case SCORE_BOARD: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/// Players that were never added successfully get NO_PLAYER, so their commands fail like unknown names do
+PlayerHandle MatchIngress::player_handle(const string& name) const {
+    auto handle = player_handles.find(name);
+    return handle == player_handles.end() ? NO_PLAYER : handle->second;
+}
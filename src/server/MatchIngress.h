@@ -0,0 +1,57 @@
+#ifndef CSXD_MATCHINGRESS_H
+#define CSXD_MATCHINGRESS_H
+
+
+#include <string>
+#include <unordered_map>
+
+#include "BoundedMpscQueue.h"
+#include "Command.h"
+#include "Interactions.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// A command already parsed by the connection it arrived on. Players and weapons are named, since only the match knows
+/// their handles. A command whose arguments could not be parsed is submitted as rejected and answered with an error.
+struct IngressCommand {
+    Command command;
+    ull time;
+    /// Player of every command but SCORE-BOARD; the attacker of a TAP
+    string player;
+    /// Attacked player of a TAP
+    string other_player;
+    /// Weapon of a BUY
+    string weapon;
+    Side side;
+    WeaponType weapon_type;
+    bool rejected;
+};
+
+/// Command ingress of one live match. Connection threads submit commands concurrently through a bounded lock-free
+/// queue, and the worker that owns the match drains it in batches, executing the commands in queue order through the
+/// pre-parsed command API of Interactions. Commands of one connection therefore keep their order.
+class MatchIngress {
+public:
+    MatchIngress(Interactions& interactions, size_t capacity);
+    MatchIngress(const MatchIngress&) = delete;
+    MatchIngress& operator=(const MatchIngress&) = delete;
+
+    bool try_submit(IngressCommand& command);
+    size_t drain(size_t max_commands);
+    size_t get_capacity() const;
+
+private:
+    void execute(const IngressCommand& command);
+    static bool has_valid_arguments(const IngressCommand& command);
+    PlayerHandle player_handle(const string& name) const;
+
+    BoundedMpscQueue<IngressCommand> queue;
+    Interactions& interactions;
+    IngressCommand drained_command;
+    unordered_map<string, PlayerHandle> player_handles;
+};
+
+
+#endif //CSXD_MATCHINGRESS_H
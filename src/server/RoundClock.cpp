@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include "RoundClock.h"
+#include "exceptions/NullPointerException.h"
+
+RoundClock::RoundClock(ull start_time) : wheel(start_time), matches(), free_matches(), match_count(0) {
+}
+
+uint RoundClock::add_match(GamePlay* game_play, RoundObserver* observer) {
+    if (game_play == nullptr) {
+        throw NullPointerException("game_play");
+    }
+    if (game_play->has_ended()) {
+        throw invalid_argument("game_play has already ended");
+    }
+
+    uint match;
+    if (free_matches.empty()) {
+        match = matches.size();
+        matches.push_back(ClockedMatch {nullptr, nullptr, 0, ENTRY, 0});
+    }
+    else {
+        match = free_matches.back();
+        free_matches.pop_back();
+    }
+    matches[match].game_play = game_play;
+    matches[match].observer = observer;
+    match_count++;
+
+    start_round(match, wheel.get_time());
+    return match;
+}
+
+/// Takes the match off the clock, which leaves its game as it is
+void RoundClock::remove_match(uint match) {
+    wheel.cancel(clocked_match(match).timer);
+    matches[match].game_play = nullptr;
+    matches[match].observer = nullptr;
+    free_matches.push_back(match);
+    match_count--;
+}
+
+bool RoundClock::has_match(uint match) const {
+    return match < matches.size() && matches[match].game_play != nullptr;
+}
+
+size_t RoundClock::get_match_count() const {
+    return match_count;
+}
+
+/// Ends every phase due by time, in the order they were due. A match whose last round ends is taken off the clock.
+/// Returns the number of phases ended.
+size_t RoundClock::advance(ull time) {
+    return wheel.advance(time, [this](ull match) { end_phase(match); });
+}
+
+ull RoundClock::get_time() const {
+    return wheel.get_time();
+}
+
+ull RoundClock::get_round_time(uint match) const {
+    return wheel.get_time() - clocked_match(match).round_started_at;
+}
+
+/// For commands of a clocked match, which take their round time from the clock instead of a timestamp
+void RoundClock::update_round_time(uint match) const {
+    clocked_match(match).game_play->set_round_time(get_round_time(match));
+}
+
+/// Milliseconds of the monotonic clock
+ull RoundClock::now() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RoundClock::start_round(uint match, ull started_at) {
+    matches[match].round_started_at = started_at;
+    matches[match].game_play->set_round_time(0);
+    schedule_phase_end(match, ENTRY);
+}
+
+void RoundClock::schedule_phase_end(uint match, Phase phase) {
+    ClockedMatch& clocked = matches[match];
+    ull round_length = clocked.game_play->get_round_length();
+    ull phase_length = round_length;
+    if (phase == ENTRY) {
+        phase_length = min(clocked.game_play->get_enter_time_limit(), round_length);
+    }
+    else if (phase == BUY_TIME) {
+        phase_length = min(clocked.game_play->get_buy_time_limit(), round_length);
+    }
+
+    clocked.phase = phase;
+    clocked.timer = wheel.schedule(clocked.round_started_at + phase_length, match);
+}
+
+/// The observer is told last, once the match is in its next phase, so it may remove the match
+void RoundClock::end_phase(uint match) {
+    ClockedMatch& clocked = matches[match];
+    GamePlay* game_play = clocked.game_play;
+    RoundObserver* observer = clocked.observer;
+
+    switch (clocked.phase) {
+        case ENTRY: {
+            game_play->set_round_time(game_play->get_enter_time_limit());
+            schedule_phase_end(match, BUY_TIME);
+            if (observer != nullptr) {
+                observer->on_entry_closed(match);
+            }
+            break;
+        }
+        case BUY_TIME: {
+            game_play->set_round_time(game_play->get_buy_time_limit());
+            schedule_phase_end(match, ROUND);
+            if (observer != nullptr) {
+                observer->on_buy_time_ended(match);
+            }
+            break;
+        }
+        case ROUND: {
+            ull round_ended_at = clocked.round_started_at + game_play->get_round_length();
+            game_play->set_round_time(game_play->get_round_length());
+            Side winner_side = game_play->determine_winner_and_go_next_round();
+            bool match_ended = game_play->has_ended();
+            if (match_ended) {
+                remove_match(match);
+            }
+            else {
+                start_round(match, round_ended_at);
+            }
+            if (observer != nullptr) {
+                observer->on_round_ended(match, winner_side, match_ended);
+            }
+            break;
+        }
+    }
+}
+
+RoundClock::ClockedMatch& RoundClock::clocked_match(uint match) {
+    return const_cast<ClockedMatch&>(static_cast<const RoundClock*>(this)->clocked_match(match));
+}
+
+const RoundClock::ClockedMatch& RoundClock::clocked_match(uint match) const {
+    if (!has_match(match)) {
+        throw out_of_range("match is not on the clock");
+    }
+    return matches[match];
+}
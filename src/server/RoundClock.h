@@ -0,0 +1,65 @@
+#ifndef CSXD_ROUNDCLOCK_H
+#define CSXD_ROUNDCLOCK_H
+
+
+#include <vector>
+
+#include "TimerWheel.h"
+#include "RoundObserver.h"
+#include "GamePlay.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Real-time round clock for live matches. Instead of waiting for command timestamps, it closes entry and the buy time
+/// and ends each round once its length has passed, then starts the next one. All matches share one timer wheel and
+/// each has exactly one pending timer, its next phase change, so a single thread drives any number of matches by
+/// calling advance() with the monotonic time. Times are in milliseconds, like the round times of GamePlay.
+class RoundClock {
+public:
+    explicit RoundClock(ull start_time = now());
+    RoundClock(const RoundClock&) = delete;
+    RoundClock& operator=(const RoundClock&) = delete;
+
+    /// game_play and observer must outlive the match on the clock. Its current round starts now.
+    uint add_match(GamePlay* game_play, RoundObserver* observer = nullptr);
+    void remove_match(uint match);
+    bool has_match(uint match) const;
+    size_t get_match_count() const;
+    size_t advance(ull time);
+    ull get_time() const;
+    ull get_round_time(uint match) const;
+    void update_round_time(uint match) const;
+
+    static ull now();
+
+private:
+    enum Phase {
+        ENTRY,
+        BUY_TIME,
+        ROUND
+    };
+
+    struct ClockedMatch {
+        GamePlay* game_play;
+        RoundObserver* observer;
+        ull round_started_at;
+        Phase phase;
+        TimerId timer;
+    };
+
+    void start_round(uint match, ull started_at);
+    void schedule_phase_end(uint match, Phase phase);
+    void end_phase(uint match);
+    ClockedMatch& clocked_match(uint match);
+    const ClockedMatch& clocked_match(uint match) const;
+
+    TimerWheel wheel;
+    vector<ClockedMatch> matches;
+    vector<uint> free_matches;
+    size_t match_count;
+};
+
+
+#endif //CSXD_ROUNDCLOCK_H
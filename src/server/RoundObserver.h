@@ -0,0 +1,18 @@
+#ifndef CSXD_ROUNDOBSERVER_H
+#define CSXD_ROUNDOBSERVER_H
+
+
+#include "models/player/Side.h"
+
+/// Told by a RoundClock when a phase of a clocked match's round ends on its own
+class RoundObserver {
+public:
+    virtual ~RoundObserver() = default;
+
+    virtual void on_entry_closed(uint match) = 0;
+    virtual void on_buy_time_ended(uint match) = 0;
+    virtual void on_round_ended(uint match, Side winner_side, bool match_ended) = 0;
+};
+
+
+#endif //CSXD_ROUNDOBSERVER_H
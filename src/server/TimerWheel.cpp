@@ -0,0 +1,161 @@
+#include <algorithm>
+
+#include "TimerWheel.h"
+
+TimerWheel::TimerWheel(ull start_time) : now(start_time), active_timers(0), timers(), free_timers(), slots(), level_timers(), firing(NONE) {
+    slots.fill(NONE);
+    level_timers.fill(0);
+}
+
+/// Returns an id for cancelling the timer. A deadline that has already passed fires on the next advance.
+TimerId TimerWheel::schedule(ull deadline, ull token) {
+    uint timer;
+    if (free_timers.empty()) {
+        timer = timers.size();
+        timers.push_back(Timer {0, 0, 0, NONE, NONE, NONE});
+    }
+    else {
+        timer = free_timers.back();
+        free_timers.pop_back();
+    }
+
+    timers[timer].deadline = deadline;
+    timers[timer].token = token;
+    place(timer, max(deadline, now + 1));
+    active_timers++;
+
+    return (ull) timers[timer].generation << 32 | timer;
+}
+
+/// Returns false if the timer has already fired or been cancelled
+bool TimerWheel::cancel(TimerId timer_id) {
+    uint timer = timer_id & 0xFFFFFFFF;
+    if (timer >= timers.size() || timers[timer].generation != timer_id >> 32 || timers[timer].slot == NONE) {
+        return false;
+    }
+    unlink(timer);
+    release(timer);
+    return true;
+}
+
+/// Moves the wheel to time, firing every timer due by then in deadline order. on_expired may schedule and cancel
+/// timers. Returns the number of timers fired.
+size_t TimerWheel::advance(ull time, const function<void(ull token)>& on_expired) {
+    size_t fired = 0;
+    while (now < time) {
+        if (active_timers == 0) {
+            now = time;
+            break;
+        }
+
+        // Nothing fires before the next turn of the lowest level that holds timers
+        uint empty_levels = 0;
+        while (empty_levels < LEVELS - 1 && level_timers[empty_levels] == 0) {
+            empty_levels++;
+        }
+        if (empty_levels > 0) {
+            now = min(now | ((1ull << (empty_levels * SLOT_BITS)) - 1), time - 1);
+        }
+        now++;
+
+        for (uint level = LEVELS - 1; level > 0; level--) {
+            if ((now & ((1ull << (level * SLOT_BITS)) - 1)) == 0) {
+                cascade(level);
+            }
+        }
+
+        uint& slot = head(now & (SLOTS - 1));
+        firing = slot;
+        slot = NONE;
+        for (uint timer = firing; timer != NONE; timer = timers[timer].next) {
+            timers[timer].slot = FIRING;
+            level_timers[0]--;
+        }
+        for (uint timer = firing; timer != NONE; timer = firing) {
+            unlink(timer);
+            ull token = timers[timer].token;
+            release(timer);
+            fired++;
+            on_expired(token);
+        }
+    }
+    return fired;
+}
+
+ull TimerWheel::get_time() const {
+    return now;
+}
+
+size_t TimerWheel::size() const {
+    return active_timers;
+}
+
+/// A timer goes to the lowest level whose span covers the time left until it expires
+void TimerWheel::place(uint timer, ull expiry) {
+    ull span = 1ull << (LEVELS * SLOT_BITS);
+    if (expiry - now >= span) {
+        expiry = now + span - 1;
+    }
+
+    uint level = 0;
+    while (level < LEVELS - 1 && expiry - now >= 1ull << ((level + 1) * SLOT_BITS)) {
+        level++;
+    }
+    link(timer, level * SLOTS + ((expiry >> (level * SLOT_BITS)) & (SLOTS - 1)));
+}
+
+void TimerWheel::link(uint timer, uint slot) {
+    uint& first = head(slot);
+    if (slot != FIRING) {
+        level_timers[slot / SLOTS]++;
+    }
+    timers[timer].slot = slot;
+    timers[timer].previous = NONE;
+    timers[timer].next = first;
+    if (first != NONE) {
+        timers[first].previous = timer;
+    }
+    first = timer;
+}
+
+void TimerWheel::unlink(uint timer) {
+    Timer& unlinked = timers[timer];
+    if (unlinked.slot != FIRING) {
+        level_timers[unlinked.slot / SLOTS]--;
+    }
+    if (unlinked.previous != NONE) {
+        timers[unlinked.previous].next = unlinked.next;
+    }
+    else {
+        head(unlinked.slot) = unlinked.next;
+    }
+    if (unlinked.next != NONE) {
+        timers[unlinked.next].previous = unlinked.previous;
+    }
+}
+
+void TimerWheel::release(uint timer) {
+    timers[timer].slot = NONE;
+    timers[timer].generation++;
+    free_timers.push_back(timer);
+    active_timers--;
+}
+
+/// Spreads the level's slot that has just come around over the levels below it
+void TimerWheel::cascade(uint level) {
+    uint slot = level * SLOTS + ((now >> (level * SLOT_BITS)) & (SLOTS - 1));
+    uint timer = head(slot);
+    head(slot) = NONE;
+    for (uint cascaded = timer; cascaded != NONE; cascaded = timers[cascaded].next) {
+        level_timers[level]--;
+    }
+    while (timer != NONE) {
+        uint next = timers[timer].next;
+        place(timer, max(timers[timer].deadline, now));
+        timer = next;
+    }
+}
+
+uint& TimerWheel::head(uint slot) {
+    return slot == FIRING ? firing : slots[slot];
+}
@@ -0,0 +1,66 @@
+#ifndef CSXD_TIMERWHEEL_H
+#define CSXD_TIMERWHEEL_H
+
+
+#include <array>
+#include <functional>
+#include <vector>
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+typedef ull TimerId;
+
+/// Hierarchical timer wheel with one tick per time unit. Level 0 has a slot per tick, every level above it has a slot per
+/// full turn of the level below, so scheduling and cancelling are O(1) and a timer is moved down a level at most
+/// LEVELS - 1 times before it fires. Deadlines further away than the wheel spans are parked in the top level and
+/// re-placed whenever their slot comes around. Advancing skips the turns of levels that hold no timers, so idle time
+/// costs little. Not thread-safe.
+class TimerWheel {
+public:
+    static constexpr uint SLOT_BITS = 6;
+    static constexpr uint SLOTS = 1 << SLOT_BITS;
+    static constexpr uint LEVELS = 4;
+
+    explicit TimerWheel(ull start_time = 0);
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    TimerId schedule(ull deadline, ull token);
+    bool cancel(TimerId timer);
+    size_t advance(ull time, const function<void(ull token)>& on_expired);
+    ull get_time() const;
+    size_t size() const;
+
+private:
+    static constexpr uint NONE = ~0u;
+    static constexpr uint FIRING = LEVELS * SLOTS;
+
+    struct Timer {
+        ull deadline;
+        ull token;
+        uint generation;
+        uint slot;
+        uint previous;
+        uint next;
+    };
+
+    void place(uint timer, ull expiry);
+    void link(uint timer, uint slot);
+    void unlink(uint timer);
+    void release(uint timer);
+    void cascade(uint level);
+    uint& head(uint slot);
+
+    ull now;
+    size_t active_timers;
+    vector<Timer> timers;
+    vector<uint> free_timers;
+    array<uint, LEVELS * SLOTS> slots;
+    array<size_t, LEVELS> level_timers;
+    uint firing;
+};
+
+
+#endif //CSXD_TIMERWHEEL_H
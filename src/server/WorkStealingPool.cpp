@@ -0,0 +1,108 @@
+#include <stdexcept>
+
+#include "WorkStealingPool.h"
+
+WorkStealingPool::WorkStealingPool(size_t worker_count) : queues(), workers(), next_queue(0), stolen_tasks(0), queued_tasks(0), unfinished_tasks(0), stopping(false) {
+    if (worker_count == 0) {
+        throw out_of_range("worker_count should be more than 0");
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        queues.push_back(make_unique<TaskQueue>());
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        workers.emplace_back(&WorkStealingPool::run, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    wait();
+    {
+        lock_guard<mutex> lock(state_mutex);
+        stopping = true;
+    }
+    tasks_available.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::submit(function<void()> task) {
+    auto& queue = *queues[next_queue++ % queues.size()];
+    {
+        lock_guard<mutex> lock(queue.tasks_mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        lock_guard<mutex> lock(state_mutex);
+        queued_tasks++;
+        unfinished_tasks++;
+    }
+    tasks_available.notify_one();
+}
+
+void WorkStealingPool::wait() {
+    unique_lock<mutex> lock(state_mutex);
+    all_tasks_done.wait(lock, [this] { return unfinished_tasks == 0; });
+}
+
+size_t WorkStealingPool::get_worker_count() const {
+    return workers.size();
+}
+
+ull WorkStealingPool::get_stolen_task_count() const {
+    return stolen_tasks;
+}
+
+void WorkStealingPool::run(size_t worker) {
+    function<void()> task;
+    while (true) {
+        {
+            unique_lock<mutex> lock(state_mutex);
+            tasks_available.wait(lock, [this] { return stopping || queued_tasks > 0; });
+            if (queued_tasks == 0) {
+                return;
+            }
+            queued_tasks--;
+        }
+
+        // The task counted above is in one of the queues, though another worker may be taking it from there
+        while (!take_task(worker, task)) {
+            this_thread::yield();
+        }
+        task();
+        task = nullptr;
+
+        bool done;
+        {
+            lock_guard<mutex> lock(state_mutex);
+            done = --unfinished_tasks == 0;
+        }
+        if (done) {
+            all_tasks_done.notify_all();
+        }
+    }
+}
+
+bool WorkStealingPool::take_task(size_t worker, function<void()>& task) {
+    {
+        auto& own_queue = *queues[worker];
+        lock_guard<mutex> lock(own_queue.tasks_mutex);
+        if (!own_queue.tasks.empty()) {
+            task = std::move(own_queue.tasks.front());
+            own_queue.tasks.pop_front();
+            return true;
+        }
+    }
+
+    for (size_t i = 1; i < queues.size(); i++) {
+        auto& victim_queue = *queues[(worker + i) % queues.size()];
+        lock_guard<mutex> lock(victim_queue.tasks_mutex);
+        if (!victim_queue.tasks.empty()) {
+            task = std::move(victim_queue.tasks.back());
+            victim_queue.tasks.pop_back();
+            stolen_tasks++;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,55 @@
+#ifndef CSXD_WORKSTEALINGPOOL_H
+#define CSXD_WORKSTEALINGPOOL_H
+
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Thread pool where every worker has its own task queue. Submitted tasks are spread over the queues, a worker takes
+/// tasks from the front of its own queue and, once that is empty, steals from the back of the others. Long tasks
+/// therefore do not hold up the tasks queued behind them.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(size_t worker_count);
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+    ~WorkStealingPool();
+
+    void submit(function<void()> task);
+    void wait();
+    size_t get_worker_count() const;
+    ull get_stolen_task_count() const;
+
+private:
+    struct TaskQueue {
+        mutex tasks_mutex;
+        deque<function<void()>> tasks;
+    };
+
+    void run(size_t worker);
+    bool take_task(size_t worker, function<void()>& task);
+
+    vector<unique_ptr<TaskQueue>> queues;
+    vector<thread> workers;
+    atomic<size_t> next_queue;
+    atomic<ull> stolen_tasks;
+    mutex state_mutex;
+    condition_variable tasks_available;
+    condition_variable all_tasks_done;
+    size_t queued_tasks;
+    size_t unfinished_tasks;
+    bool stopping;
+};
+
+
+#endif //CSXD_WORKSTEALINGPOOL_H
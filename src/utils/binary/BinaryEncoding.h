@@ -0,0 +1,59 @@
+#ifndef CSXD_BINARYENCODING_H
+#define CSXD_BINARYENCODING_H
+
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// LEB128 varints and length-prefixed strings appended to, and read back from, an in-memory buffer.
+/// Readers advance position and throw invalid_argument when the data ends early.
+
+inline void append_varint(string& buffer, ull value) {
+    while (value >= 0x80) {
+        buffer.push_back(char(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(char(value));
+}
+
+inline void append_string(string& buffer, string_view value) {
+    append_varint(buffer, value.size());
+    buffer.append(value);
+}
+
+inline unsigned char read_byte(string_view data, size_t& position) {
+    if (position >= data.size()) {
+        throw invalid_argument("binary data is truncated");
+    }
+    return data[position++];
+}
+
+inline ull read_varint(string_view data, size_t& position) {
+    ull value = 0;
+    for (uint shift = 0; shift < 64; shift += 7) {
+        unsigned char byte = read_byte(data, position);
+        value |= ull(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw invalid_argument("binary data has an invalid varint");
+}
+
+inline string_view read_string(string_view data, size_t& position) {
+    ull size = read_varint(data, position);
+    if (size > data.size() - position) {
+        throw invalid_argument("binary data is truncated");
+    }
+    string_view value = data.substr(position, size);
+    position += size;
+    return value;
+}
+
+
+#endif //CSXD_BINARYENCODING_H
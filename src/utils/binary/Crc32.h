@@ -0,0 +1,37 @@
+#ifndef CSXD_CRC32_H
+#define CSXD_CRC32_H
+
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+using namespace std;
+
+/// CRC-32 with the reflected 0xEDB88320 polynomial of zlib and Ethernet, one table lookup per byte
+
+constexpr array<uint32_t, 256> make_crc32_table() {
+    array<uint32_t, 256> table = {};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+inline constexpr array<uint32_t, 256> CRC32_TABLE = make_crc32_table();
+
+/// Continues the crc of the data before, so a crc can be computed over several pieces; starts from 0
+inline uint32_t update_crc32(uint32_t crc, string_view data) {
+    crc = ~crc;
+    for (unsigned char byte : data) {
+        crc = CRC32_TABLE[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+
+#endif //CSXD_CRC32_H
@@ -1,47 +1,105 @@
+#include <array>
 #include <fstream>
+#include <utility>
 
 #include "nlohmann/json.hpp"
 
 #include "Data.h"
+#include "WeaponDefinition.h"
 #include "exceptions/WeaponNotFoundException.h"
+#include "utils/trace/Trace.h"
 
 using namespace std;
 using json = nlohmann::json;
 
-unordered_map<string, shared_ptr<Weapon>> Data::weapons;
-
-void Data::load_weapons() {
-//    weapons["Desert-Eagle"] = make_shared<Weapon>("Desert-Eagle", 600, 53, 175, PISTOL, COUNTER_TERRORIST);
-//    weapons["UPS-S"] = make_shared<Weapon>("UPS-S", 300, 13, 225, PISTOL, COUNTER_TERRORIST);
-//    weapons["M4A1"] = make_shared<Weapon>("M4A1", 2700, 29, 100, HEAVY, COUNTER_TERRORIST);
-//    weapons["Revolver"] = make_shared<Weapon>("Revolver", 600, 51, 150, PISTOL, TERRORIST);
-//    weapons["Glock-18"] = make_shared<Weapon>("Glock-18", 300, 11, 200, PISTOL, TERRORIST);
-//    weapons["AK"] = make_shared<Weapon>("AK", 2700, 31, 100, HEAVY, TERRORIST);
-//    weapons["AWP"] = make_shared<Weapon>("AWP", 4300, 110, 50, HEAVY, ALL);
-//    weapons["Knife"] = make_shared<Weapon>("Knife", 0, 43, 500, MELEE, ALL);
-    ifstream weapons_json_file("weapons.json");
+namespace {
+
+#include "utils/data/WeaponCatalog.inc"
+
+constexpr size_t COMPILED_WEAPON_COUNT = sizeof(COMPILED_WEAPONS) / sizeof(COMPILED_WEAPONS[0]);
+
+/// Weapons of the compiled catalog, built once from the table. Names fit in the small string buffer.
+array<Weapon, COMPILED_WEAPON_COUNT>& compiled_weapons() {
+    static array<Weapon, COMPILED_WEAPON_COUNT> weapons = [] {
+        array<Weapon, COMPILED_WEAPON_COUNT> built_weapons;
+        for (size_t i = 0; i < COMPILED_WEAPON_COUNT; i++) {
+            const auto& definition = COMPILED_WEAPONS[i];
+            built_weapons[i] = Weapon(string(definition.name), definition.price, definition.damage_per_hit,
+                                      definition.money_per_kill, definition.type, definition.available_for);
+        }
+        return built_weapons;
+    }();
+    return weapons;
+}
+
+}
+
+mutex Data::publish_mutex;
+shared_ptr<const WeaponCatalog> Data::catalog = make_shared<const WeaponCatalog>(1, Data::get_compiled_weapons());
+atomic<ull> Data::catalog_version(1);
+
+/// Weapons compiled from weapons.json at build time, without reading or parsing any file. They live in static storage
+/// and are shared without ownership.
+vector<shared_ptr<Weapon>> Data::get_compiled_weapons() {
+    vector<shared_ptr<Weapon>> weapons;
+    weapons.reserve(COMPILED_WEAPON_COUNT);
+    for (auto& weapon : compiled_weapons()) {
+        weapons.emplace_back(shared_ptr<Weapon>(), &weapon);
+    }
+    return weapons;
+}
+
+vector<shared_ptr<Weapon>> Data::load_weapons(const string& weapons_path) {
+    ifstream weapons_json_file(weapons_path);
+    if (!weapons_json_file) {
+        throw invalid_argument("weapons file can not be opened: " + weapons_path);
+    }
     json weapon_list = json::parse(weapons_json_file);
+    vector<shared_ptr<Weapon>> weapons;
     for(Weapon weapon : weapon_list) {
-        weapons[weapon.get_name()] = make_shared<Weapon>(weapon);
+        weapons.push_back(make_shared<Weapon>(weapon));
     }
+    return weapons;
 }
 
+/// Publishes the compiled catalog as a new version
 void Data::load() {
-    load_weapons();
+    CSXD_TRACE_SPAN("Data::load");
+    publish(get_compiled_weapons());
+}
+
+/// Publishes a custom catalog read from a weapons JSON file as a new version
+void Data::load(const string& weapons_path) {
+    CSXD_TRACE_SPAN("Data::load");
+    publish(load_weapons(weapons_path));
+}
+
+void Data::publish(vector<shared_ptr<Weapon>> weapons) {
+    lock_guard<mutex> lock(publish_mutex);
+    ull version = catalog_version.load() + 1;
+    shared_ptr<const WeaponCatalog> published_catalog = make_shared<const WeaponCatalog>(version, std::move(weapons));
+    atomic_store(&catalog, published_catalog);
+    catalog_version.store(version, memory_order_release);
+}
+
+/// Pins the current catalog. Not meant for hot paths, which should look weapons up in a catalog they already hold.
+shared_ptr<const WeaponCatalog> Data::get_catalog() {
+    return atomic_load(&catalog);
+}
+
+/// Version of the current catalog, readable without locking to tell whether a pinned catalog is still current
+ull Data::get_catalog_version() {
+    return catalog_version.load(memory_order_acquire);
 }
 
 shared_ptr<Weapon> Data::get_weapon_by_name(const string& name) {
-    if(weapons.find(name) == weapons.end()) {
+    auto weapon = try_get_weapon_by_name(name);
+    if(weapon == nullptr) {
         throw WeaponNotFoundException();
     }
-    return weapons[name];
+    return weapon;
 }
 
 shared_ptr<Weapon> Data::try_get_weapon_by_name(const string& name) {
-    try {
-        return get_weapon_by_name(name);
-    }
-    catch (...) {
-        return nullptr;
-    }
+    return get_catalog()->find(name);
 }
@@ -2,24 +2,38 @@
 #define CSXD_DATA_H
 
 
+#include <atomic>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <string>
 
 #include "models/weapon/WeaponType.h"
 #include "models/weapon/Weapon.h"
+#include "WeaponCatalog.h"
 
 using namespace std;
 
+typedef unsigned long long ull;
+
+/// Holds the current weapon catalog. Loading publishes a new catalog version, RCU style: readers that pinned an older
+/// version keep it alive and unchanged until they release it, so publishing never waits for them.
 class Data {
 public:
     static void load();
+    static void load(const string& weapons_path);
+    static shared_ptr<const WeaponCatalog> get_catalog();
+    static ull get_catalog_version();
     static shared_ptr<Weapon> get_weapon_by_name(const string& name);
     static shared_ptr<Weapon> try_get_weapon_by_name(const string& name);
 
 private:
-    static void load_weapons();
+    static vector<shared_ptr<Weapon>> get_compiled_weapons();
+    static vector<shared_ptr<Weapon>> load_weapons(const string& weapons_path);
+    static void publish(vector<shared_ptr<Weapon>> weapons);
 
-    static unordered_map<string, shared_ptr<Weapon>> weapons;
+    static mutex publish_mutex;
+    static shared_ptr<const WeaponCatalog> catalog;
+    static atomic<ull> catalog_version;
 };
 
 
@@ -0,0 +1,47 @@
+#include <stdexcept>
+#include <utility>
+
+#include "WeaponCatalog.h"
+#include "exceptions/NullPointerException.h"
+
+WeaponCatalog::WeaponCatalog(ull version, vector<shared_ptr<Weapon>> weapons) : version(version), weapons(std::move(weapons)), names(), indexes() {
+    names.reserve(this->weapons.size());
+    for (size_t i = 0; i < this->weapons.size(); i++) {
+        if (this->weapons[i] == nullptr) {
+            throw NullPointerException("weapon");
+        }
+        names.push_back(this->weapons[i]->get_name());
+        if (!indexes.emplace(names.back(), i).second) {
+            throw invalid_argument("weapon is defined twice: " + names.back());
+        }
+    }
+    if (names.size() <= MAX_SCANNED_SIZE) {
+        indexes.clear();
+    }
+}
+
+ull WeaponCatalog::get_version() const {
+    return version;
+}
+
+const vector<shared_ptr<Weapon>>& WeaponCatalog::get_weapons() const {
+    return weapons;
+}
+
+/// Returns nullptr when the catalog has no weapon of that name
+shared_ptr<Weapon> WeaponCatalog::find(const string& name) const {
+    if (names.size() <= MAX_SCANNED_SIZE) {
+        for (size_t i = 0; i < names.size(); i++) {
+            if (names[i] == name) {
+                return weapons[i];
+            }
+        }
+        return nullptr;
+    }
+
+    auto index = indexes.find(name);
+    if (index == indexes.end()) {
+        return nullptr;
+    }
+    return weapons[index->second];
+}
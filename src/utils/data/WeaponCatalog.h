@@ -0,0 +1,39 @@
+#ifndef CSXD_WEAPONCATALOG_H
+#define CSXD_WEAPONCATALOG_H
+
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "models/weapon/Weapon.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Immutable, versioned set of weapons. A catalog is never changed once built; a new version is published instead,
+/// and everyone holding the old one keeps using it until they let go of it.
+class WeaponCatalog {
+public:
+    WeaponCatalog(ull version, vector<shared_ptr<Weapon>> weapons);
+    WeaponCatalog(const WeaponCatalog&) = delete;
+    WeaponCatalog& operator=(const WeaponCatalog&) = delete;
+
+    ull get_version() const;
+    const vector<shared_ptr<Weapon>>& get_weapons() const;
+    shared_ptr<Weapon> find(const string& name) const;
+
+private:
+    /// Catalogs up to this size are scanned instead of hashed, which is faster for so few names
+    static const size_t MAX_SCANNED_SIZE = 16;
+
+    ull version;
+    vector<shared_ptr<Weapon>> weapons;
+    vector<string> names;
+    unordered_map<string, size_t> indexes;
+};
+
+
+#endif //CSXD_WEAPONCATALOG_H
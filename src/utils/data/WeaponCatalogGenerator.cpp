@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "models/weapon/Weapon.h"
+
+using namespace std;
+using json = nlohmann::json;
+
+namespace {
+
+const char* weapon_type_name(WeaponType type) {
+    switch (type) {
+        case MELEE:
+            return "MELEE";
+        case PISTOL:
+            return "PISTOL";
+        case HEAVY:
+            return "HEAVY";
+    }
+    throw invalid_argument("weapon type is invalid");
+}
+
+const char* side_name(Side side) {
+    switch (side) {
+        case COUNTER_TERRORIST:
+            return "COUNTER_TERRORIST";
+        case TERRORIST:
+            return "TERRORIST";
+        case ALL:
+            return "ALL";
+    }
+    throw invalid_argument("side is invalid");
+}
+
+}
+
+/// Build step that compiles a weapons JSON file into a constexpr table, sorted by name and free of duplicates.
+/// Usage: CSxDWeaponCatalogGenerator <weapons.json> <output.inc>
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        cerr << "usage: " << argv[0] << " <weapons.json> <output.inc>" << endl;
+        return 2;
+    }
+
+    try {
+        ifstream weapons_json_file(argv[1]);
+        if (!weapons_json_file) {
+            throw invalid_argument(string("weapons file can not be opened: ") + argv[1]);
+        }
+        vector<Weapon> weapons = json::parse(weapons_json_file);
+        sort(weapons.begin(), weapons.end(), [](const Weapon& w1, const Weapon& w2) {
+            return w1.get_name() < w2.get_name();
+        });
+        auto duplicate = adjacent_find(weapons.begin(), weapons.end(), [](const Weapon& w1, const Weapon& w2) {
+            return w1.get_name() == w2.get_name();
+        });
+        if (duplicate != weapons.end()) {
+            throw invalid_argument("weapon is defined twice: " + duplicate->get_name());
+        }
+
+        ofstream output(argv[2]);
+        output << "// Generated from " << filesystem::path(argv[1]).filename().string() << " by CSxDWeaponCatalogGenerator. Do not edit.\n\n"
+               << "constexpr WeaponDefinition COMPILED_WEAPONS[] = {\n";
+        for (const auto& weapon : weapons) {
+            output << "    {" << json(weapon.get_name()).dump() << ", " << weapon.get_price() << ", "
+                   << weapon.get_damage_per_hit() << ", " << weapon.get_money_per_kill() << ", "
+                   << weapon_type_name(weapon.get_type()) << ", ";
+            for (auto side : {ALL, COUNTER_TERRORIST, TERRORIST}) {
+                if (weapon.is_available_for(side)) {
+                    output << side_name(side);
+                    break;
+                }
+            }
+            output << "},\n";
+        }
+        output << "};\n";
+        if (!output) {
+            throw runtime_error(string("catalog can not be written: ") + argv[2]);
+        }
+    }
+    catch (const exception& ex) {
+        cerr << argv[0] << ": " << ex.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#ifndef CSXD_WEAPONDEFINITION_H
+#define CSXD_WEAPONDEFINITION_H
+
+
+#include <string_view>
+
+#include "models/weapon/WeaponType.h"
+#include "models/player/Side.h"
+
+using namespace std;
+
+/// Plain description of a weapon, usable in constant expressions
+struct WeaponDefinition {
+    string_view name;
+    uint price;
+    uint damage_per_hit;
+    uint money_per_kill;
+    WeaponType type;
+    Side available_for;
+};
+
+
+#endif //CSXD_WEAPONDEFINITION_H
@@ -0,0 +1,191 @@
+#include <stdexcept>
+
+#include "MatchGenerator.h"
+
+namespace {
+
+const char* const TERRORIST_WEAPONS[] = {"AK", "AWP", "Glock-18", "Revolver"};
+const char* const COUNTER_TERRORIST_WEAPONS[] = {"M4A1", "AWP", "Desert-Eagle", "UPS-S"};
+const char* const TERRORIST_ONLY_WEAPONS[] = {"AK", "Glock-18", "Revolver"};
+const char* const COUNTER_TERRORIST_ONLY_WEAPONS[] = {"M4A1", "Desert-Eagle", "UPS-S"};
+const char* const WEAPON_TYPES[] = {"knife", "pistol", "heavy"};
+
+const ull FIRST_COMMAND_TIME = 3 * 1000;
+const ull LAST_COMMAND_TIME = 44 * 1000;
+
+}
+
+MatchGenerator::MatchGenerator(MatchGeneratorOptions options) : options(options), state(options.seed), text() {
+    if (options.rounds == 0) {
+        throw out_of_range("rounds should be more than 0");
+    }
+    if (options.team_size == 0 || options.team_size > 1000) {
+        throw out_of_range("team_size should be between 1 and 1000 (inclusive)");
+    }
+    if (options.buy_weight + options.tap_weight + options.get_health_weight + options.get_money_weight +
+        options.score_board_weight == 0) {
+        throw out_of_range("at least one command weight should be more than 0");
+    }
+    if (options.invalid_ratio < 0 || options.invalid_ratio > 1) {
+        throw out_of_range("invalid_ratio should be between 0 and 1 (inclusive)");
+    }
+}
+
+string MatchGenerator::generate() {
+    state = options.seed;
+    text.clear();
+
+    text += to_string(options.rounds);
+    text += '\n';
+    for (uint round = 1; round <= options.rounds; round++) {
+        append_round(round);
+    }
+
+    return std::move(text);
+}
+
+ull MatchGenerator::get_command_count() const {
+    return 2ull * options.team_size + (ull) options.rounds * options.commands_per_round;
+}
+
+void MatchGenerator::append_round(uint round) {
+    uint player_count = round == 1 ? 2 * options.team_size : 0;
+
+    text += "ROUND ";
+    text += to_string(player_count + options.commands_per_round);
+    text += '\n';
+
+    for (uint i = 0; i < player_count; i++) {
+        Side side = i % 2 == 0 ? TERRORIST : COUNTER_TERRORIST;
+        text += "ADD-USER ";
+        append_player(side, i / 2);
+        text += side == TERRORIST ? " Terrorist " : " Counter-Terrorist ";
+        append_time(i);
+        text += '\n';
+    }
+
+    for (uint i = 0; i < options.commands_per_round; i++) {
+        append_command(FIRST_COMMAND_TIME + (LAST_COMMAND_TIME - FIRST_COMMAND_TIME) * i / options.commands_per_round);
+    }
+}
+
+void MatchGenerator::append_command(ull time) {
+    uint pick = next_below(options.buy_weight + options.tap_weight + options.get_health_weight +
+                           options.get_money_weight + options.score_board_weight);
+
+    if (pick < options.buy_weight) {
+        append_buy(next_is_invalid());
+    }
+    else if ((pick -= options.buy_weight) < options.tap_weight) {
+        append_tap(next_is_invalid());
+    }
+    else if ((pick -= options.tap_weight) < options.get_health_weight) {
+        append_player_command("GET-HEALTH ", next_is_invalid());
+    }
+    else if ((pick -= options.get_health_weight) < options.get_money_weight) {
+        append_player_command("GET-MONEY ", next_is_invalid());
+    }
+    else {
+        text += "SCORE-BOARD ";
+    }
+
+    append_time(time);
+    text += '\n';
+}
+
+void MatchGenerator::append_buy(bool invalid) {
+    Side side = next_below(2) == 0 ? TERRORIST : COUNTER_TERRORIST;
+    bool unknown_player = invalid && next_below(2) == 0;
+
+    text += "BUY ";
+    if (unknown_player) {
+        text += "Ghost";
+        text += to_string(next_below(options.team_size));
+    }
+    else {
+        append_player(side, next_below(options.team_size));
+    }
+    text += ' ';
+    if (invalid && !unknown_player) {
+        text += side == TERRORIST ? COUNTER_TERRORIST_ONLY_WEAPONS[next_below(3)] : TERRORIST_ONLY_WEAPONS[next_below(3)];
+    }
+    else {
+        text += side == TERRORIST ? TERRORIST_WEAPONS[next_below(4)] : COUNTER_TERRORIST_WEAPONS[next_below(4)];
+    }
+    text += ' ';
+}
+
+void MatchGenerator::append_tap(bool invalid) {
+    Side side = next_below(2) == 0 ? TERRORIST : COUNTER_TERRORIST;
+    Side opponent_side = side == TERRORIST ? COUNTER_TERRORIST : TERRORIST;
+
+    text += "TAP ";
+    append_player(side, next_below(options.team_size));
+    text += ' ';
+    if (!invalid) {
+        append_player(opponent_side, next_below(options.team_size));
+        text += ' ';
+        text += WEAPON_TYPES[next_below(3)];
+    }
+    else if (next_below(2) == 0) {
+        // Everyone holds a knife, so the attack is rejected for friendly fire rather than a missing weapon
+        append_player(side, next_below(options.team_size));
+        text += " knife";
+    }
+    else {
+        text += "Ghost";
+        text += to_string(next_below(options.team_size));
+        text += ' ';
+        text += WEAPON_TYPES[next_below(3)];
+    }
+    text += ' ';
+}
+
+void MatchGenerator::append_player_command(const char* command, bool invalid) {
+    text += command;
+    if (invalid) {
+        text += "Ghost";
+        text += to_string(next_below(options.team_size));
+    }
+    else {
+        append_random_player();
+    }
+    text += ' ';
+}
+
+void MatchGenerator::append_player(Side side, uint index) {
+    text += side == TERRORIST ? "T" : "CT";
+    text += to_string(index);
+}
+
+void MatchGenerator::append_random_player() {
+    append_player(next_below(2) == 0 ? TERRORIST : COUNTER_TERRORIST, next_below(options.team_size));
+}
+
+void MatchGenerator::append_time(ull time) {
+    ull minutes = time / (60 * 1000);
+    ull seconds = time / 1000 % 60;
+    ull milliseconds = time % 1000;
+    char formatted[] = {
+        char('0' + minutes / 10 % 10), char('0' + minutes % 10), ':',
+        char('0' + seconds / 10), char('0' + seconds % 10), ':',
+        char('0' + milliseconds / 100), char('0' + milliseconds / 10 % 10), char('0' + milliseconds % 10)
+    };
+    text.append(formatted, sizeof(formatted));
+}
+
+bool MatchGenerator::next_is_invalid() {
+    return next_random() % 1000000 < (ull) (options.invalid_ratio * 1000000);
+}
+
+/// splitmix64, which unlike the standard distributions gives the same sequence with every standard library
+ull MatchGenerator::next_random() {
+    ull z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+uint MatchGenerator::next_below(uint bound) {
+    return next_random() % bound;
+}
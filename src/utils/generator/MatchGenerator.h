@@ -0,0 +1,60 @@
+#ifndef CSXD_MATCHGENERATOR_H
+#define CSXD_MATCHGENERATOR_H
+
+
+#include <string>
+
+#include "models/player/Side.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Command mix of a generated match. Weights are relative, so {BUY 1, TAP 4} makes every fifth command a BUY.
+struct MatchGeneratorOptions {
+    uint rounds = 10;
+    uint team_size = 5;
+    uint commands_per_round = 100;
+    uint buy_weight = 1;
+    uint tap_weight = 4;
+    uint get_health_weight = 1;
+    uint get_money_weight = 1;
+    uint score_board_weight = 1;
+    /// Share of BUY, TAP, GET-HEALTH and GET-MONEY commands that are made to be rejected, in [0, 1]
+    double invalid_ratio = 0;
+    ull seed = 1;
+};
+
+/// Deterministic generator of match inputs in the Interactions text format. The same options always produce the same
+/// text, on every platform, so generated inputs can be used for regression tracking.
+///
+/// Every player is added at the start of the first round and all commands of a round fall inside the buy phase.
+/// Valid commands use existing players, opposing teams and weapons of the player's side; invalid ones use unknown
+/// players, friendly fire or weapons of the other side.
+class MatchGenerator {
+public:
+    explicit MatchGenerator(MatchGeneratorOptions options);
+
+    string generate();
+    ull get_command_count() const;
+
+private:
+    void append_round(uint round);
+    void append_command(ull time);
+    void append_buy(bool invalid);
+    void append_tap(bool invalid);
+    void append_player_command(const char* command, bool invalid);
+    void append_player(Side side, uint index);
+    void append_random_player();
+    void append_time(ull time);
+    bool next_is_invalid();
+    ull next_random();
+    uint next_below(uint bound);
+
+    MatchGeneratorOptions options;
+    ull state;
+    string text;
+};
+
+
+#endif //CSXD_MATCHGENERATOR_H
@@ -0,0 +1,152 @@
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "EventJournal.h"
+#include "utils/binary/BinaryEncoding.h"
+#include "utils/binary/Crc32.h"
+
+EventJournal::EventJournal(ostream& stream) : stream(&stream), descriptor(-1), path(), events(), frame(), commit_count(0) {
+    write_header();
+}
+
+/// The file is created with a header if it does not exist or is not appended to
+EventJournal::EventJournal(const string& path, bool append) : stream(nullptr), descriptor(-1), path(path), events(), frame(), commit_count(0) {
+    descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | (append ? 0 : O_TRUNC), 0644);
+    if (descriptor < 0) {
+        throw system_error(errno, generic_category(), path);
+    }
+
+    off_t size = lseek(descriptor, 0, SEEK_END);
+    if (size < 0) {
+        int error = errno;
+        close(descriptor);
+        throw system_error(error, generic_category(), path);
+    }
+    if (size == 0) {
+        write_header();
+    }
+}
+
+/// Events that were not committed are discarded, as they would be by a crash
+EventJournal::~EventJournal() {
+    if (descriptor >= 0) {
+        close(descriptor);
+    }
+}
+
+void EventJournal::player_added(string_view name, Side side, ull entry_time, uint hp, uint max_money, uint money) {
+    events.push_back(char(PLAYER_ADDED));
+    append_string(events, name);
+    events.push_back(char(side));
+    append_varint(events, entry_time);
+    append_varint(events, hp);
+    append_varint(events, max_money);
+    append_varint(events, money);
+}
+
+void EventJournal::money_changed(PlayerHandle player, uint money) {
+    write_event(MONEY_CHANGED, player);
+    append_varint(events, money);
+}
+
+void EventJournal::damage_taken(PlayerHandle player, uint damage) {
+    write_event(DAMAGE_TAKEN, player);
+    append_varint(events, damage);
+}
+
+void EventJournal::kill_added(PlayerHandle player) {
+    write_event(KILL_ADDED, player);
+}
+
+void EventJournal::weapon_equipped(PlayerHandle player, string_view weapon_name) {
+    write_event(WEAPON_EQUIPPED, player);
+    append_string(events, weapon_name);
+}
+
+void EventJournal::weapon_dropped(PlayerHandle player, WeaponType weapon_type) {
+    write_event(WEAPON_DROPPED, player);
+    events.push_back(char(weapon_type));
+}
+
+void EventJournal::round_ended(Side winner) {
+    events.push_back(char(ROUND_ENDED));
+    events.push_back(char(winner));
+}
+
+/// Snapshot of the game after the buffered events, committed together with them
+void EventJournal::snapshot(string_view game_snapshot) {
+    frame.clear();
+    if (!events.empty()) {
+        write_frame(EVENTS_FRAME, events);
+        events.clear();
+    }
+    write_frame(SNAPSHOT_FRAME, game_snapshot);
+    write(frame);
+    commit_count++;
+}
+
+/// Writes the buffered events as one frame and makes them durable
+void EventJournal::commit() {
+    if (events.empty()) {
+        return;
+    }
+    frame.clear();
+    write_frame(EVENTS_FRAME, events);
+    events.clear();
+    write(frame);
+    commit_count++;
+}
+
+size_t EventJournal::get_pending_size() const {
+    return events.size();
+}
+
+ull EventJournal::get_commit_count() const {
+    return commit_count;
+}
+
+void EventJournal::write_header() {
+    frame.assign(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    append_varint(frame, JOURNAL_VERSION);
+    write(frame);
+}
+
+void EventJournal::write_event(JournalEventType type, PlayerHandle player) {
+    events.push_back(char(type));
+    append_varint(events, player);
+}
+
+void EventJournal::write_frame(JournalFrameType type, string_view payload) {
+    char type_byte = char(type);
+    frame.push_back(type_byte);
+    append_string(frame, payload);
+    uint32_t crc = update_crc32(update_crc32(0, string_view(&type_byte, 1)), payload);
+    for (int shift = 0; shift < 32; shift += 8) {
+        frame.push_back(char(crc >> shift));
+    }
+}
+
+void EventJournal::write(string_view data) {
+    if (stream != nullptr) {
+        stream->write(data.data(), data.size());
+        stream->flush();
+        return;
+    }
+
+    while (!data.empty()) {
+        ssize_t written = ::write(descriptor, data.data(), data.size());
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw system_error(errno, generic_category(), path);
+        }
+        data.remove_prefix(written);
+    }
+    if (fdatasync(descriptor) < 0) {
+        throw system_error(errno, generic_category(), path);
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef CSXD_EVENTJOURNAL_H
+#define CSXD_EVENTJOURNAL_H
+
+
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "JournalFormat.h"
+#include "models/player/Side.h"
+#include "models/weapon/WeaponType.h"
+#include "models/game/PlayerHandle.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Appends state-changing game events to a journal, see JournalFormat.h. Events are buffered and only written by
+/// commit(), as one frame, so a round costs a single write. When opened on a path, every commit is also synced to disk.
+/// A journal opened on a path replaces what the file held, unless append continues it, as after a recovery from it.
+class EventJournal {
+public:
+    explicit EventJournal(ostream& stream);
+    explicit EventJournal(const string& path, bool append = false);
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+    ~EventJournal();
+
+    void player_added(string_view name, Side side, ull entry_time, uint hp, uint max_money, uint money);
+    void money_changed(PlayerHandle player, uint money);
+    void damage_taken(PlayerHandle player, uint damage);
+    void kill_added(PlayerHandle player);
+    void weapon_equipped(PlayerHandle player, string_view weapon_name);
+    void weapon_dropped(PlayerHandle player, WeaponType weapon_type);
+    void round_ended(Side winner);
+    void snapshot(string_view game_snapshot);
+    void commit();
+    size_t get_pending_size() const;
+    ull get_commit_count() const;
+
+private:
+    void write_header();
+    void write_event(JournalEventType type, PlayerHandle player);
+    void write_frame(JournalFrameType type, string_view payload);
+    void write(string_view data);
+
+    ostream* stream;
+    int descriptor;
+    string path;
+    string events;
+    string frame;
+    ull commit_count;
+};
+
+
+#endif //CSXD_EVENTJOURNAL_H
@@ -0,0 +1,114 @@
+#include <stdexcept>
+
+#include "EventJournalReader.h"
+#include "utils/binary/BinaryEncoding.h"
+#include "utils/binary/Crc32.h"
+
+EventJournalReader::EventJournalReader(string_view journal) : journal(journal), position(0), torn_tail(false) {
+    if (journal.substr(0, sizeof(JOURNAL_MAGIC)) != string_view(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC))) {
+        throw invalid_argument("journal has an invalid magic");
+    }
+    position = sizeof(JOURNAL_MAGIC);
+    if (read_varint(journal, position) != JOURNAL_VERSION) {
+        throw invalid_argument("journal version is not supported");
+    }
+}
+
+/// Returns false at the end of the journal or at a torn last frame
+bool EventJournalReader::next(JournalFrame& frame) {
+    if (position == journal.size() || torn_tail) {
+        return false;
+    }
+
+    size_t frame_position = position;
+    uint32_t stored_crc = 0;
+    try {
+        frame.type = static_cast<JournalFrameType>(read_byte(journal, frame_position));
+        frame.payload = read_string(journal, frame_position);
+        for (int shift = 0; shift < 32; shift += 8) {
+            stored_crc |= uint32_t(read_byte(journal, frame_position)) << shift;
+        }
+    }
+    catch (const invalid_argument& ex) {
+        torn_tail = true;
+        return false;
+    }
+    if (stored_crc != update_crc32(update_crc32(0, journal.substr(position, 1)), frame.payload)) {
+        if (frame_position == journal.size()) {
+            torn_tail = true;
+            return false;
+        }
+        throw invalid_argument("journal frame is corrupt");
+    }
+    if (frame.type > SNAPSHOT_FRAME) {
+        throw invalid_argument("journal frame type is invalid");
+    }
+
+    position = frame_position;
+    return true;
+}
+
+bool EventJournalReader::has_torn_tail() const {
+    return torn_tail;
+}
+
+/// Players and round winners are always on one team
+Side EventJournalReader::read_side(string_view events, size_t& position) {
+    unsigned char side = read_byte(events, position);
+    if (!is_team_side(side)) {
+        throw invalid_argument("journal side is invalid");
+    }
+    return static_cast<Side>(side);
+}
+
+/// Decodes the event at position of an EVENTS_FRAME payload and advances past it. Returns false at the end.
+bool EventJournalReader::next_event(string_view events, size_t& position, JournalEvent& event) {
+    if (position == events.size()) {
+        return false;
+    }
+
+    event.type = static_cast<JournalEventType>(read_byte(events, position));
+    switch (event.type) {
+        case PLAYER_ADDED: {
+            event.name = read_string(events, position);
+            event.side = read_side(events, position);
+            event.entry_time = read_varint(events, position);
+            event.value = read_varint(events, position);
+            event.max_money = read_varint(events, position);
+            event.money = read_varint(events, position);
+            break;
+        }
+        case MONEY_CHANGED:
+        case DAMAGE_TAKEN: {
+            event.player = read_varint(events, position);
+            event.value = read_varint(events, position);
+            break;
+        }
+        case KILL_ADDED: {
+            event.player = read_varint(events, position);
+            break;
+        }
+        case WEAPON_EQUIPPED: {
+            event.player = read_varint(events, position);
+            event.name = read_string(events, position);
+            break;
+        }
+        case WEAPON_DROPPED: {
+            event.player = read_varint(events, position);
+            unsigned char weapon_type = read_byte(events, position);
+            if (!is_weapon_type(weapon_type)) {
+                throw invalid_argument("journal weapon type is invalid");
+            }
+            event.weapon_type = static_cast<WeaponType>(weapon_type);
+            break;
+        }
+        case ROUND_ENDED: {
+            event.side = read_side(events, position);
+            break;
+        }
+        default: {
+            throw invalid_argument("journal event type is invalid");
+        }
+    }
+    return true;
+}
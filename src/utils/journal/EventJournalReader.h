@@ -0,0 +1,56 @@
+#ifndef CSXD_EVENTJOURNALREADER_H
+#define CSXD_EVENTJOURNALREADER_H
+
+
+#include <string_view>
+
+#include "JournalFormat.h"
+#include "models/player/Side.h"
+#include "models/weapon/WeaponType.h"
+#include "models/game/PlayerHandle.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+struct JournalFrame {
+    JournalFrameType type;
+    string_view payload;
+};
+
+struct JournalEvent {
+    JournalEventType type;
+    PlayerHandle player;
+    /// Money after a MONEY_CHANGED, damage of a DAMAGE_TAKEN, hp of a PLAYER_ADDED
+    uint value;
+    /// Name of the player of a PLAYER_ADDED or of the weapon of a WEAPON_EQUIPPED, a view into the journal
+    string_view name;
+    /// Side of a PLAYER_ADDED, winner of a ROUND_ENDED
+    Side side;
+    WeaponType weapon_type;
+    ull entry_time;
+    uint max_money;
+    uint money;
+};
+
+/// Decodes an event journal, see JournalFormat.h. Frames and names are views into the journal, which must outlive the
+/// reader. A truncated or mismatching last frame, as left by a crash during a commit, ends the journal.
+class EventJournalReader {
+public:
+    explicit EventJournalReader(string_view journal);
+
+    bool next(JournalFrame& frame);
+    bool has_torn_tail() const;
+
+    static bool next_event(string_view events, size_t& position, JournalEvent& event);
+
+private:
+    static Side read_side(string_view events, size_t& position);
+
+    string_view journal;
+    size_t position;
+    bool torn_tail;
+};
+
+
+#endif //CSXD_EVENTJOURNALREADER_H
@@ -0,0 +1,45 @@
+#ifndef CSXD_JOURNALFORMAT_H
+#define CSXD_JOURNALFORMAT_H
+
+
+/// Binary event journal layout. All integers are LEB128 varints, strings are a varint length followed by the bytes.
+///
+///   header:  "CSXJ" magic, format version
+///   frame:   frame type byte, payload length, payload, CRC-32 of the type byte and payload as 4 little-endian bytes
+///     EVENTS_FRAME      the events of one commit, normally one round
+///     SNAPSHOT_FRAME    a game snapshot, see GameSnapshotFormat.h
+///   event:   event type byte, then its fields
+///     PLAYER_ADDED      name, side, entry time, hp, max money, money
+///     MONEY_CHANGED     player, money after the change
+///     DAMAGE_TAKEN      player, damage
+///     KILL_ADDED        player
+///     WEAPON_EQUIPPED   player, weapon name
+///     WEAPON_DROPPED    player, weapon type
+///     ROUND_ENDED       winner side
+///
+/// Players are handles, which the game hands out in the order of the PLAYER_ADDED events. Events are already validated
+/// and are applied without checking the game rules again, only sides and weapon types are checked to be enumerators.
+/// Frames are appended whole, so a crash leaves at most a torn last frame: cut short, or with a CRC that does not match
+/// because its bytes did not all reach the disk. Readers ignore it. A CRC mismatch in any earlier frame is corruption
+/// and fails the read. A game is rebuilt from the last snapshot frame and the events after it.
+
+const char JOURNAL_MAGIC[] = {'C', 'S', 'X', 'J'};
+const unsigned JOURNAL_VERSION = 2;
+
+enum JournalFrameType {
+    EVENTS_FRAME,
+    SNAPSHOT_FRAME
+};
+
+enum JournalEventType {
+    PLAYER_ADDED,
+    MONEY_CHANGED,
+    DAMAGE_TAKEN,
+    KILL_ADDED,
+    WEAPON_EQUIPPED,
+    WEAPON_DROPPED,
+    ROUND_ENDED
+};
+
+
+#endif //CSXD_JOURNALFORMAT_H
@@ -0,0 +1,39 @@
+#ifndef CSXD_MATCHLOGFORMAT_H
+#define CSXD_MATCHLOGFORMAT_H
+
+
+/// Binary match log layout. All integers are LEB128 varints.
+///
+///   header:  "CSXD" magic, format version, round count
+///   record:  one record type byte, then its fields
+///     ROUND_RECORD        command count of the round
+///     ADD_USER_RECORD     time delta, player, side byte
+///     GET_HEALTH_RECORD   time delta, player
+///     GET_MONEY_RECORD    time delta, player
+///     BUY_RECORD          time delta, player, weapon
+///     TAP_RECORD          time delta, attacker, attacked, weapon type byte
+///     SCORE_BOARD_RECORD  time delta
+///     REJECTED_RECORD     time delta
+///
+/// Time deltas are zigzag encoded and relative to the previous command of the round, the first one to 0.
+/// Players and weapons are interned names: an id equal to the number of names seen so far defines the next name and
+/// is followed by its length and bytes, any smaller id refers back to a defined name.
+/// REJECTED_RECORD stands for a command whose arguments did not parse, such as an unknown side or weapon type, so the
+/// side and weapon type bytes of other records must be a team side and a WeaponType.
+
+const char MATCH_LOG_MAGIC[] = {'C', 'S', 'X', 'D'};
+const unsigned MATCH_LOG_VERSION = 1;
+
+enum MatchLogRecordType {
+    ROUND_RECORD,
+    ADD_USER_RECORD,
+    GET_HEALTH_RECORD,
+    GET_MONEY_RECORD,
+    BUY_RECORD,
+    TAP_RECORD,
+    SCORE_BOARD_RECORD,
+    REJECTED_RECORD
+};
+
+
+#endif //CSXD_MATCHLOGFORMAT_H
@@ -0,0 +1,128 @@
+#include <stdexcept>
+
+#include "MatchLogReader.h"
+
+MatchLogReader::MatchLogReader(string_view log) : log(log), position(0), rounds(0), time(0), player_names(), weapon_names() {
+    if (log.substr(0, sizeof(MATCH_LOG_MAGIC)) != string_view(MATCH_LOG_MAGIC, sizeof(MATCH_LOG_MAGIC))) {
+        throw invalid_argument("log is not a match log");
+    }
+    position = sizeof(MATCH_LOG_MAGIC);
+    if (read_varint() != MATCH_LOG_VERSION) {
+        throw invalid_argument("match log version is not supported");
+    }
+    rounds = read_varint();
+}
+
+uint MatchLogReader::get_rounds() const {
+    return rounds;
+}
+
+/// Returns false at the end of the log
+bool MatchLogReader::next(MatchLogRecord& record) {
+    if (position == log.size()) {
+        return false;
+    }
+
+    record.type = static_cast<MatchLogRecordType>(read_byte());
+    if (record.type == ROUND_RECORD) {
+        record.command_count = read_varint();
+        time = 0;
+        return true;
+    }
+    if (record.type > REJECTED_RECORD) {
+        throw invalid_argument("match log record type is invalid");
+    }
+
+    ull delta = read_varint();
+    time += (delta >> 1) ^ (~(delta & 1) + 1);
+    record.time = time;
+
+    switch (record.type) {
+        case ADD_USER_RECORD: {
+            record.player = read_name(player_names);
+            unsigned char side = read_byte();
+            if (!is_team_side(side)) {
+                throw invalid_argument("match log side is invalid");
+            }
+            record.side = static_cast<Side>(side);
+            break;
+        }
+        case GET_HEALTH_RECORD:
+        case GET_MONEY_RECORD: {
+            record.player = read_name(player_names);
+            break;
+        }
+        case BUY_RECORD: {
+            record.player = read_name(player_names);
+            record.weapon = read_name(weapon_names);
+            break;
+        }
+        case TAP_RECORD: {
+            record.player = read_name(player_names);
+            record.other_player = read_name(player_names);
+            unsigned char weapon_type = read_byte();
+            if (!is_weapon_type(weapon_type)) {
+                throw invalid_argument("match log weapon type is invalid");
+            }
+            record.weapon_type = static_cast<WeaponType>(weapon_type);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    return true;
+}
+
+string_view MatchLogReader::get_player_name(uint id) const {
+    return player_names.at(id);
+}
+
+string_view MatchLogReader::get_weapon_name(uint id) const {
+    return weapon_names.at(id);
+}
+
+size_t MatchLogReader::get_player_count() const {
+    return player_names.size();
+}
+
+size_t MatchLogReader::get_weapon_count() const {
+    return weapon_names.size();
+}
+
+uint MatchLogReader::read_name(vector<string_view>& names) {
+    ull id = read_varint();
+    if (id < names.size()) {
+        return id;
+    }
+    if (id > names.size()) {
+        throw invalid_argument("match log refers to an undefined name");
+    }
+
+    ull size = read_varint();
+    if (size > log.size() - position) {
+        throw invalid_argument("match log is truncated");
+    }
+    names.push_back(log.substr(position, size));
+    position += size;
+    return id;
+}
+
+unsigned char MatchLogReader::read_byte() {
+    if (position == log.size()) {
+        throw invalid_argument("match log is truncated");
+    }
+    return log[position++];
+}
+
+ull MatchLogReader::read_varint() {
+    ull value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        unsigned char byte = read_byte();
+        value |= static_cast<ull>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw invalid_argument("match log varint is too long");
+}
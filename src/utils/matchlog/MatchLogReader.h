@@ -0,0 +1,57 @@
+#ifndef CSXD_MATCHLOGREADER_H
+#define CSXD_MATCHLOGREADER_H
+
+
+#include <string_view>
+#include <vector>
+
+#include "MatchLogFormat.h"
+#include "models/player/Side.h"
+#include "models/weapon/WeaponType.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+struct MatchLogRecord {
+    MatchLogRecordType type;
+    /// Round time of a command record
+    ull time;
+    /// Command count of a ROUND_RECORD
+    uint command_count;
+    /// Interned ids of the player, or of the attacker and attacked of a TAP_RECORD
+    uint player;
+    uint other_player;
+    /// Interned id of the weapon of a BUY_RECORD
+    uint weapon;
+    WeaponType weapon_type;
+    Side side;
+};
+
+/// Decodes a binary match log, see MatchLogFormat.h. Names are views into the log, which must outlive the reader.
+class MatchLogReader {
+public:
+    explicit MatchLogReader(string_view log);
+
+    uint get_rounds() const;
+    bool next(MatchLogRecord& record);
+    string_view get_player_name(uint id) const;
+    string_view get_weapon_name(uint id) const;
+    size_t get_player_count() const;
+    size_t get_weapon_count() const;
+
+private:
+    uint read_name(vector<string_view>& names);
+    unsigned char read_byte();
+    ull read_varint();
+
+    string_view log;
+    size_t position;
+    uint rounds;
+    ull time;
+    vector<string_view> player_names;
+    vector<string_view> weapon_names;
+};
+
+
+#endif //CSXD_MATCHLOGREADER_H
@@ -0,0 +1,90 @@
+#include "MatchLogWriter.h"
+
+MatchLogWriter::MatchLogWriter(ostream& stream) : out(stream), player_ids(), weapon_ids(), name_key(), previous_time(0) {}
+
+void MatchLogWriter::begin_match(uint rounds) {
+    out << string_view(MATCH_LOG_MAGIC, sizeof(MATCH_LOG_MAGIC));
+    write_varint(MATCH_LOG_VERSION);
+    write_varint(rounds);
+}
+
+void MatchLogWriter::begin_round(uint command_count) {
+    out << char(ROUND_RECORD);
+    write_varint(command_count);
+    previous_time = 0;
+}
+
+void MatchLogWriter::add_user(string_view name, Side side, ull time) {
+    write_command(ADD_USER_RECORD, time);
+    write_name(player_ids, name);
+    out << char(side);
+}
+
+void MatchLogWriter::get_health(string_view name, ull time) {
+    write_command(GET_HEALTH_RECORD, time);
+    write_name(player_ids, name);
+}
+
+void MatchLogWriter::get_money(string_view name, ull time) {
+    write_command(GET_MONEY_RECORD, time);
+    write_name(player_ids, name);
+}
+
+void MatchLogWriter::buy(string_view name, string_view weapon_name, ull time) {
+    write_command(BUY_RECORD, time);
+    write_name(player_ids, name);
+    write_name(weapon_ids, weapon_name);
+}
+
+void MatchLogWriter::tap(string_view attacker_name, string_view attacked_name, WeaponType weapon_type, ull time) {
+    write_command(TAP_RECORD, time);
+    write_name(player_ids, attacker_name);
+    write_name(player_ids, attacked_name);
+    out << char(weapon_type);
+}
+
+void MatchLogWriter::scoreboard(ull time) {
+    write_command(SCORE_BOARD_RECORD, time);
+}
+
+void MatchLogWriter::reject(ull time) {
+    write_command(REJECTED_RECORD, time);
+}
+
+void MatchLogWriter::flush() {
+    out.flush();
+}
+
+void MatchLogWriter::write_command(MatchLogRecordType type, ull time) {
+    auto delta = static_cast<long long>(time - previous_time);
+    out << char(type);
+    write_varint((static_cast<ull>(delta) << 1) ^ static_cast<ull>(delta >> 63));
+    previous_time = time;
+}
+
+/// Names are defined inline the first time they are written, later references only carry the id
+void MatchLogWriter::write_name(unordered_map<string, uint>& ids, string_view name) {
+    name_key.assign(name.data(), name.size());
+    auto id = ids.find(name_key);
+    if (id != ids.end()) {
+        write_varint(id->second);
+        return;
+    }
+
+    uint new_id = ids.size();
+    ids.emplace(name_key, new_id);
+    write_varint(new_id);
+    write_varint(name.size());
+    out << name;
+}
+
+void MatchLogWriter::write_varint(ull value) {
+    char bytes[10];
+    size_t size = 0;
+    while (value >= 0x80) {
+        bytes[size++] = static_cast<char>(value | 0x80);
+        value >>= 7;
+    }
+    bytes[size++] = static_cast<char>(value);
+    out << string_view(bytes, size);
+}
@@ -0,0 +1,50 @@
+#ifndef CSXD_MATCHLOGWRITER_H
+#define CSXD_MATCHLOGWRITER_H
+
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "MatchLogFormat.h"
+#include "models/player/Side.h"
+#include "models/weapon/WeaponType.h"
+#include "utils/output/OutputBuffer.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Encodes a command stream into the binary match log format, see MatchLogFormat.h
+class MatchLogWriter {
+public:
+    explicit MatchLogWriter(ostream& stream);
+    MatchLogWriter(const MatchLogWriter&) = delete;
+    MatchLogWriter& operator=(const MatchLogWriter&) = delete;
+
+    void begin_match(uint rounds);
+    void begin_round(uint command_count);
+    void add_user(string_view name, Side side, ull time);
+    void get_health(string_view name, ull time);
+    void get_money(string_view name, ull time);
+    void buy(string_view name, string_view weapon_name, ull time);
+    void tap(string_view attacker_name, string_view attacked_name, WeaponType weapon_type, ull time);
+    void scoreboard(ull time);
+    void reject(ull time);
+    void flush();
+
+private:
+    void write_command(MatchLogRecordType type, ull time);
+    void write_name(unordered_map<string, uint>& ids, string_view name);
+    void write_varint(ull value);
+
+    OutputBuffer out;
+    unordered_map<string, uint> player_ids;
+    unordered_map<string, uint> weapon_ids;
+    string name_key;
+    ull previous_time;
+};
+
+
+#endif //CSXD_MATCHLOGWRITER_H
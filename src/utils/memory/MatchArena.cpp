@@ -0,0 +1,4 @@
+#include "MatchArena.h"
+
+MatchArena::MatchArena() : pmr::monotonic_buffer_resource(INITIAL_SIZE) {
+}
@@ -0,0 +1,23 @@
+#ifndef CSXD_MATCHARENA_H
+#define CSXD_MATCHARENA_H
+
+
+#include <memory_resource>
+
+using namespace std;
+
+/// Monotonic arena for everything one match allocates: players, teams, scoreboards and the player store. Nothing is
+/// freed until the arena is destroyed, which releases the whole match in one step, so it must outlive the match.
+/// Not thread-safe; a match is only ever touched by one thread at a time.
+class MatchArena : public pmr::monotonic_buffer_resource {
+public:
+    /// Large enough for a full match of ten players a side, so such a match makes a single upstream allocation
+    static const size_t INITIAL_SIZE = 6 * 1024;
+
+    MatchArena();
+    MatchArena(const MatchArena&) = delete;
+    MatchArena& operator=(const MatchArena&) = delete;
+};
+
+
+#endif //CSXD_MATCHARENA_H
@@ -0,0 +1,101 @@
+#include <iomanip>
+#include <stdexcept>
+
+#include "nlohmann/json.hpp"
+
+#include "CommandLatencies.h"
+
+namespace {
+
+const double PERCENTILES[] = {50, 90, 99, 99.9};
+const char* const PERCENTILE_NAMES[] = {"p50", "p90", "p99", "p99.9"};
+
+}
+
+CommandLatencies::CommandLatencies(uint sample_period) : histograms(), sample_period(sample_period), countdown(sample_period) {
+    if (sample_period == 0) {
+        throw out_of_range("sample_period should be more than 0");
+    }
+}
+
+const LatencyHistogram& CommandLatencies::get_histogram(Command command) const {
+    return histograms[command];
+}
+
+const LatencyHistogram& CommandLatencies::get_round_end_histogram() const {
+    return histograms[ROUND_END];
+}
+
+uint CommandLatencies::get_sample_period() const {
+    return sample_period;
+}
+
+void CommandLatencies::merge(const CommandLatencies& latencies) {
+    for (size_t i = 0; i < METRIC_COUNT; i++) {
+        histograms[i].merge(latencies.histograms[i]);
+    }
+}
+
+void CommandLatencies::reset() {
+    for (auto& histogram : histograms) {
+        histogram.reset();
+    }
+    countdown = sample_period;
+}
+
+/// One row per command in nanoseconds, commands that were never timed included
+void CommandLatencies::write_text(ostream& stream) const {
+    stream << left << setw(12) << "command" << right << setw(10) << "count" << setw(10) << "mean";
+    for (const char* name : PERCENTILE_NAMES) {
+        stream << setw(10) << name;
+    }
+    stream << setw(10) << "max" << '\n';
+
+    for (size_t i = 0; i < METRIC_COUNT; i++) {
+        const LatencyHistogram& histogram = histograms[i];
+        stream << left << setw(12) << get_metric_name(i) << right << setw(10) << histogram.get_count() << setw(10)
+               << (ull) histogram.get_mean();
+        for (double percentile : PERCENTILES) {
+            stream << setw(10) << histogram.get_value_at_percentile(percentile);
+        }
+        stream << setw(10) << histogram.get_max() << '\n';
+    }
+}
+
+/// Percentiles in nanoseconds, and the non-empty buckets as [lowest value, count] pairs so dumps can be merged
+void CommandLatencies::write_json(ostream& stream) const {
+    nlohmann::ordered_json metrics = nlohmann::ordered_json::object();
+    for (size_t i = 0; i < METRIC_COUNT; i++) {
+        const LatencyHistogram& histogram = histograms[i];
+        nlohmann::ordered_json metric;
+        metric["count"] = histogram.get_count();
+        metric["mean"] = histogram.get_mean();
+        metric["min"] = histogram.get_min();
+        for (size_t j = 0; j < size(PERCENTILES); j++) {
+            metric[PERCENTILE_NAMES[j]] = histogram.get_value_at_percentile(PERCENTILES[j]);
+        }
+        metric["max"] = histogram.get_max();
+
+        nlohmann::ordered_json buckets = nlohmann::ordered_json::array();
+        ull remaining = histogram.get_count();
+        for (size_t j = 0; remaining > 0 && j < LatencyHistogram::BUCKET_COUNT; j++) {
+            ull count = histogram.get_bucket_count(j);
+            if (count > 0) {
+                buckets.push_back({LatencyHistogram::get_bucket_lowest_value(j), count});
+                remaining -= count;
+            }
+        }
+        metric["buckets"] = std::move(buckets);
+        metrics[string(get_metric_name(i))] = std::move(metric);
+    }
+
+    nlohmann::ordered_json json;
+    json["unit"] = "ns";
+    json["sample_period"] = sample_period;
+    json["commands"] = std::move(metrics);
+    stream << json.dump(2) << '\n';
+}
+
+string_view CommandLatencies::get_metric_name(size_t metric) {
+    return metric == ROUND_END ? "ROUND-END" : get_command_name((Command) metric);
+}
@@ -0,0 +1,75 @@
+#ifndef CSXD_COMMANDLATENCIES_H
+#define CSXD_COMMANDLATENCIES_H
+
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <string_view>
+
+#include "Command.h"
+#include "LatencyHistogram.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Latency histograms of the commands one thread executes, one per Command plus one for round-end processing. Reading
+/// the clock costs about as much as a light command, so only one in every sample_period commands is timed; round ends
+/// are rare and always timed. Not thread-safe: every worker thread owns one, and they are merged when dumped.
+class CommandLatencies {
+public:
+    /// Keeps the timing overhead under 2% of the Interactions benchmark workload
+    static constexpr uint DEFAULT_SAMPLE_PERIOD = 16;
+    static constexpr size_t ROUND_END = SCORE_BOARD + 1;
+    static constexpr size_t METRIC_COUNT = ROUND_END + 1;
+
+    explicit CommandLatencies(uint sample_period = DEFAULT_SAMPLE_PERIOD);
+
+    /// Whether the next command should be timed
+    bool should_sample() {
+        if (--countdown != 0) {
+            return false;
+        }
+        countdown = sample_period;
+        return true;
+    }
+
+    static chrono::steady_clock::time_point now() {
+        return chrono::steady_clock::now();
+    }
+
+    void record(Command command, chrono::steady_clock::time_point started_at) {
+        record(command, elapsed_since(started_at));
+    }
+
+    void record(Command command, ull nanoseconds) {
+        histograms[command].record(nanoseconds);
+    }
+
+    void record_round_end(chrono::steady_clock::time_point started_at) {
+        histograms[ROUND_END].record(elapsed_since(started_at));
+    }
+
+    const LatencyHistogram& get_histogram(Command command) const;
+    const LatencyHistogram& get_round_end_histogram() const;
+    uint get_sample_period() const;
+    void merge(const CommandLatencies& latencies);
+    void reset();
+    void write_text(ostream& stream) const;
+    void write_json(ostream& stream) const;
+
+private:
+    static ull elapsed_since(chrono::steady_clock::time_point started_at) {
+        return chrono::duration_cast<chrono::nanoseconds>(now() - started_at).count();
+    }
+
+    static string_view get_metric_name(size_t metric);
+
+    array<LatencyHistogram, METRIC_COUNT> histograms;
+    uint sample_period;
+    uint countdown;
+};
+
+
+#endif //CSXD_COMMANDLATENCIES_H
@@ -0,0 +1,77 @@
+#include <cmath>
+#include <limits>
+
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram() : buckets(), count(0), sum(0), min(numeric_limits<ull>::max()), max(0) {
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& histogram) {
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        buckets[i] += histogram.buckets[i];
+    }
+    count += histogram.count;
+    sum += histogram.sum;
+    min = std::min(min, histogram.min);
+    max = std::max(max, histogram.max);
+}
+
+void LatencyHistogram::reset() {
+    buckets.fill(0);
+    count = 0;
+    sum = 0;
+    min = numeric_limits<ull>::max();
+    max = 0;
+}
+
+ull LatencyHistogram::get_count() const {
+    return count;
+}
+
+ull LatencyHistogram::get_min() const {
+    return count == 0 ? 0 : min;
+}
+
+ull LatencyHistogram::get_max() const {
+    return max;
+}
+
+double LatencyHistogram::get_mean() const {
+    return count == 0 ? 0 : (double) sum / count;
+}
+
+ull LatencyHistogram::get_value_at_percentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    auto rank = (ull) ceil(std::min(std::max(percentile, 0.0), 100.0) / 100 * count);
+    rank = std::max(rank, 1ULL);
+    ull seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return std::min(get_bucket_highest_value(i), max);
+        }
+    }
+    return max;
+}
+
+ull LatencyHistogram::get_bucket_count(size_t index) const {
+    return buckets[index];
+}
+
+ull LatencyHistogram::get_bucket_lowest_value(size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    uint shift = index / SUB_BUCKETS - 1;
+    return (ull) (SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+}
+
+ull LatencyHistogram::get_bucket_highest_value(size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    uint shift = index / SUB_BUCKETS - 1;
+    return get_bucket_lowest_value(index) + ((1ULL << shift) - 1);
+}
@@ -0,0 +1,66 @@
+#ifndef CSXD_LATENCYHISTOGRAM_H
+#define CSXD_LATENCYHISTOGRAM_H
+
+
+#include <array>
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Log-bucketed histogram of latencies in nanoseconds, in the manner of HDR histograms: every power of two is split
+/// into SUB_BUCKETS linear buckets, so any recorded value is reported within 1/SUB_BUCKETS of itself while the whole
+/// 64-bit range fits in a fixed array. Recording is a bucket lookup and an increment, and never allocates.
+/// Not thread-safe; every thread records into its own histograms, merged when they are read.
+class LatencyHistogram {
+public:
+    static constexpr uint SUB_BUCKET_BITS = 4;
+    static constexpr uint SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    LatencyHistogram();
+
+    void record(ull nanoseconds) {
+        buckets[get_bucket_index(nanoseconds)]++;
+        count++;
+        sum += nanoseconds;
+        if (nanoseconds < min) {
+            min = nanoseconds;
+        }
+        if (nanoseconds > max) {
+            max = nanoseconds;
+        }
+    }
+
+    void merge(const LatencyHistogram& histogram);
+    void reset();
+    ull get_count() const;
+    ull get_min() const;
+    ull get_max() const;
+    double get_mean() const;
+    /// The highest value of the bucket holding the given percentile, capped at the maximum recorded value
+    ull get_value_at_percentile(double percentile) const;
+    ull get_bucket_count(size_t index) const;
+
+    static size_t get_bucket_index(ull value) {
+        if (value < SUB_BUCKETS) {
+            return value;
+        }
+        uint exponent = 63 - __builtin_clzll(value);
+        uint shift = exponent - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKETS + ((value >> shift) & (SUB_BUCKETS - 1));
+    }
+
+    static ull get_bucket_lowest_value(size_t index);
+    static ull get_bucket_highest_value(size_t index);
+
+private:
+    array<ull, BUCKET_COUNT> buckets;
+    ull count;
+    ull sum;
+    ull min;
+    ull max;
+};
+
+
+#endif //CSXD_LATENCYHISTOGRAM_H
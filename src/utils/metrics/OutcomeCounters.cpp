@@ -0,0 +1,138 @@
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include "OutcomeCounters.h"
+
+OutcomeCounters::OutcomeCounters() : counts() {
+}
+
+void OutcomeCounters::add(size_t row, CommandOutcome outcome, ull count) {
+    counts[row][outcome] += count;
+}
+
+ull OutcomeCounters::get(size_t row, CommandOutcome outcome) const {
+    return counts[row][outcome];
+}
+
+ull OutcomeCounters::get_accepted() const {
+    ull accepted = 0;
+    for (const auto& row : counts) {
+        accepted += row[ACCEPTED_OUTCOME];
+    }
+    return accepted;
+}
+
+ull OutcomeCounters::get_rejected() const {
+    ull rejected = 0;
+    for (const auto& row : counts) {
+        for (size_t outcome = ACCEPTED_OUTCOME + 1; outcome < OUTCOME_COUNT; outcome++) {
+            rejected += row[outcome];
+        }
+    }
+    return rejected;
+}
+
+void OutcomeCounters::merge(const OutcomeCounters& counters) {
+    for (size_t row = 0; row < ROW_COUNT; row++) {
+        for (size_t outcome = 0; outcome < OUTCOME_COUNT; outcome++) {
+            counts[row][outcome] += counters.counts[row][outcome];
+        }
+    }
+}
+
+void OutcomeCounters::write_prometheus(ostream& stream) const {
+    stream << "# HELP csxd_commands_total Commands answered, by command and outcome.\n";
+    stream << "# TYPE csxd_commands_total counter\n";
+    for (size_t row = 0; row < ROW_COUNT; row++) {
+        for (size_t outcome = 0; outcome < OUTCOME_COUNT; outcome++) {
+            if (outcome != ACCEPTED_OUTCOME && counts[row][outcome] == 0) {
+                continue;
+            }
+            stream << "csxd_commands_total{command=\"" << get_row_name(row) << "\",outcome=\""
+                   << get_outcome_name((CommandOutcome) outcome) << "\"} " << counts[row][outcome] << '\n';
+        }
+    }
+}
+
+void OutcomeCounters::write_prometheus_file(const string& path) const {
+    string temporary_path = path + ".tmp";
+    {
+        ofstream file(temporary_path);
+        write_prometheus(file);
+        if (!file) {
+            throw runtime_error("could not write " + temporary_path);
+        }
+    }
+    if (rename(temporary_path.c_str(), path.c_str()) != 0) {
+        throw runtime_error("could not rename " + temporary_path + " to " + path);
+    }
+}
+
+CommandOutcome OutcomeCounters::get_outcome(ActionResult result) {
+    switch (result) {
+        case SUCCESS:
+            return ACCEPTED_OUTCOME;
+        case PLAYER_NOT_FOUND:
+            return PLAYER_NOT_FOUND_OUTCOME;
+        case ACTION_FROM_DEAD_PLAYER:
+            return ACTION_FROM_DEAD_PLAYER_OUTCOME;
+        case ACTION_AT_ILLEGAL_TIME:
+            return ACTION_AT_ILLEGAL_TIME_OUTCOME;
+        case ATTACK_DEAD_PLAYER:
+            return ATTACK_DEAD_PLAYER_OUTCOME;
+        case FRIENDLY_FIRE:
+            return FRIENDLY_FIRE_OUTCOME;
+        case NOT_ENOUGH_MONEY:
+            return NOT_ENOUGH_MONEY_OUTCOME;
+        case WEAPON_NOT_FOUND:
+            return WEAPON_NOT_FOUND_OUTCOME;
+        case WEAPON_NOT_AVAILABLE:
+            return WEAPON_NOT_AVAILABLE_OUTCOME;
+        case WEAPON_NOT_EQUIPPED:
+            return WEAPON_NOT_EQUIPPED_OUTCOME;
+        case WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED:
+            return WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED_OUTCOME;
+    }
+    return UNKNOWN_ERROR_OUTCOME;
+}
+
+string_view OutcomeCounters::get_row_name(size_t row) {
+    return row == UNPARSED_ROW ? "UNPARSED" : get_command_name((Command) row);
+}
+
+string_view OutcomeCounters::get_outcome_name(CommandOutcome outcome) {
+    switch (outcome) {
+        case ACCEPTED_OUTCOME:
+            return "accepted";
+        case PLAYER_ALREADY_IN_GAME_OUTCOME:
+            return "player_already_in_game";
+        case TEAM_FULL_OUTCOME:
+            return "team_full";
+        case PLAYER_NOT_FOUND_OUTCOME:
+            return "player_not_found";
+        case ACTION_FROM_DEAD_PLAYER_OUTCOME:
+            return "action_from_dead_player";
+        case ACTION_AT_ILLEGAL_TIME_OUTCOME:
+            return "action_at_illegal_time";
+        case ATTACK_DEAD_PLAYER_OUTCOME:
+            return "attack_dead_player";
+        case FRIENDLY_FIRE_OUTCOME:
+            return "friendly_fire";
+        case NOT_ENOUGH_MONEY_OUTCOME:
+            return "not_enough_money";
+        case WEAPON_NOT_FOUND_OUTCOME:
+            return "weapon_not_found";
+        case WEAPON_NOT_AVAILABLE_OUTCOME:
+            return "weapon_not_available";
+        case WEAPON_NOT_EQUIPPED_OUTCOME:
+            return "weapon_not_equipped";
+        case WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED_OUTCOME:
+            return "weapon_of_this_type_already_equipped";
+        case INVALID_ARGUMENTS_OUTCOME:
+            return "invalid_arguments";
+        case UNKNOWN_ERROR_OUTCOME:
+            return "unknown_error";
+    }
+    return "";
+}
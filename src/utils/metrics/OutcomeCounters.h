@@ -0,0 +1,70 @@
+#ifndef CSXD_OUTCOMECOUNTERS_H
+#define CSXD_OUTCOMECOUNTERS_H
+
+
+#include <array>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "ActionResult.h"
+#include "Command.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// What a command was answered with: accepted, or the reason it was rejected
+enum CommandOutcome {
+    ACCEPTED_OUTCOME,
+    PLAYER_ALREADY_IN_GAME_OUTCOME,
+    TEAM_FULL_OUTCOME,
+    PLAYER_NOT_FOUND_OUTCOME,
+    ACTION_FROM_DEAD_PLAYER_OUTCOME,
+    ACTION_AT_ILLEGAL_TIME_OUTCOME,
+    ATTACK_DEAD_PLAYER_OUTCOME,
+    FRIENDLY_FIRE_OUTCOME,
+    NOT_ENOUGH_MONEY_OUTCOME,
+    WEAPON_NOT_FOUND_OUTCOME,
+    WEAPON_NOT_AVAILABLE_OUTCOME,
+    WEAPON_NOT_EQUIPPED_OUTCOME,
+    WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED_OUTCOME,
+    INVALID_ARGUMENTS_OUTCOME,
+    UNKNOWN_ERROR_OUTCOME
+};
+
+/// Counts of every outcome of every command of a match. Counting is a single increment. Not thread-safe: a match
+/// counts its own commands, and hosts add them up once the match has ended.
+class OutcomeCounters {
+public:
+    /// Commands whose arguments did not parse and that were submitted pre-parsed, so their command is not known
+    static constexpr size_t UNPARSED_ROW = SCORE_BOARD + 1;
+    static constexpr size_t ROW_COUNT = UNPARSED_ROW + 1;
+    static constexpr size_t OUTCOME_COUNT = UNKNOWN_ERROR_OUTCOME + 1;
+
+    OutcomeCounters();
+
+    void count(size_t row, CommandOutcome outcome) {
+        counts[row][outcome]++;
+    }
+
+    void add(size_t row, CommandOutcome outcome, ull count);
+    ull get(size_t row, CommandOutcome outcome) const;
+    ull get_accepted() const;
+    ull get_rejected() const;
+    void merge(const OutcomeCounters& counters);
+    /// Every row's accepted count, and every non-zero rejected count, as a Prometheus counter
+    void write_prometheus(ostream& stream) const;
+    /// Replaces the file in one rename, so a scraper reading it never sees it half written
+    void write_prometheus_file(const string& path) const;
+
+    static CommandOutcome get_outcome(ActionResult result);
+    static string_view get_row_name(size_t row);
+    static string_view get_outcome_name(CommandOutcome outcome);
+
+private:
+    array<array<ull, OUTCOME_COUNT>, ROW_COUNT> counts;
+};
+
+
+#endif //CSXD_OUTCOMECOUNTERS_H
@@ -0,0 +1,62 @@
+#include <charconv>
+
+#include "OutputBuffer.h"
+
+OutputBuffer::OutputBuffer(ostream& stream, size_t flush_threshold) : stream(&stream), buffer(), flush_threshold(flush_threshold) {
+    buffer.reserve(flush_threshold);
+}
+
+OutputBuffer::~OutputBuffer() {
+    if (!buffer.empty()) {
+        flush();
+    }
+}
+
+void OutputBuffer::reset(ostream& stream) {
+    if (!buffer.empty()) {
+        flush();
+    }
+    this->stream = &stream;
+}
+
+OutputBuffer& OutputBuffer::operator<<(string_view text) {
+    buffer.append(text.data(), text.size());
+    flush_if_full();
+    return *this;
+}
+
+OutputBuffer& OutputBuffer::operator<<(char c) {
+    buffer.push_back(c);
+    flush_if_full();
+    return *this;
+}
+
+OutputBuffer& OutputBuffer::operator<<(uint value) {
+    return *this << static_cast<ull>(value);
+}
+
+OutputBuffer& OutputBuffer::operator<<(ull value) {
+    char digits[20];
+    auto result = to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr - digits);
+    flush_if_full();
+    return *this;
+}
+
+void OutputBuffer::flush() {
+    if (!buffer.empty()) {
+        stream->write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    stream->flush();
+}
+
+size_t OutputBuffer::get_pending_size() const {
+    return buffer.size();
+}
+
+void OutputBuffer::flush_if_full() {
+    if (buffer.size() >= flush_threshold) {
+        flush();
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef CSXD_OUTPUTBUFFER_H
+#define CSXD_OUTPUTBUFFER_H
+
+
+#include <string>
+#include <string_view>
+#include <ostream>
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+class OutputBuffer {
+public:
+    explicit OutputBuffer(ostream& stream, size_t flush_threshold = 64 * 1024);
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+    ~OutputBuffer();
+
+    void reset(ostream& stream);
+    OutputBuffer& operator<<(string_view text);
+    OutputBuffer& operator<<(char c);
+    OutputBuffer& operator<<(uint value);
+    OutputBuffer& operator<<(ull value);
+    void flush();
+    size_t get_pending_size() const;
+
+private:
+    void flush_if_full();
+
+    ostream* stream;
+    string buffer;
+    size_t flush_threshold;
+};
+
+
+#endif //CSXD_OUTPUTBUFFER_H
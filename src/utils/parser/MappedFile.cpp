@@ -0,0 +1,45 @@
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MappedFile.h"
+
+MappedFile::MappedFile(const string& path) : data(nullptr), size(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw system_error(errno, generic_category(), path);
+    }
+
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) < 0) {
+        int error = errno;
+        close(fd);
+        throw system_error(error, generic_category(), path);
+    }
+
+    size = file_stat.st_size;
+    if (size > 0) {
+        data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            int error = errno;
+            close(fd);
+            throw system_error(error, generic_category(), path);
+        }
+        madvise(data, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        munmap(data, size);
+    }
+}
+
+string_view MappedFile::get_contents() const {
+    return string_view(static_cast<const char*>(data), size);
+}
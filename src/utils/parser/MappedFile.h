@@ -0,0 +1,25 @@
+#ifndef CSXD_MAPPEDFILE_H
+#define CSXD_MAPPEDFILE_H
+
+
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+class MappedFile {
+public:
+    explicit MappedFile(const string& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    string_view get_contents() const;
+
+private:
+    void* data;
+    size_t size;
+};
+
+
+#endif //CSXD_MAPPEDFILE_H
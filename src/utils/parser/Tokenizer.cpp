@@ -0,0 +1,60 @@
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
+#include "Tokenizer.h"
+
+Tokenizer::Tokenizer(istream& stream) : stream(&stream), line(), rest() {}
+
+Tokenizer::Tokenizer(string_view buffer) : stream(nullptr), line(), rest(buffer) {}
+
+void Tokenizer::reset(istream& stream) {
+    this->stream = &stream;
+    rest = string_view();
+}
+
+void Tokenizer::reset(string_view buffer) {
+    stream = nullptr;
+    rest = buffer;
+}
+
+string_view Tokenizer::next() {
+    while (true) {
+        size_t begin = 0;
+        while (begin < rest.size() && isspace(static_cast<unsigned char>(rest[begin]))) {
+            begin++;
+        }
+        if (begin < rest.size()) {
+            size_t end = begin;
+            while (end < rest.size() && !isspace(static_cast<unsigned char>(rest[end]))) {
+                end++;
+            }
+            auto token = rest.substr(begin, end - begin);
+            rest.remove_prefix(end);
+            return token;
+        }
+        if (!refill()) {
+            rest = string_view();
+            return string_view();
+        }
+    }
+}
+
+uint Tokenizer::next_uint() {
+    auto token = next();
+    uint value = 0;
+    auto result = from_chars(token.data(), token.data() + token.size(), value);
+    if (result.ec != errc() || result.ptr != token.data() + token.size()) {
+        throw invalid_argument("expected an unsigned integer");
+    }
+    return value;
+}
+
+/// Tokens never span lines, so a stream is consumed one line at a time into a reused buffer
+bool Tokenizer::refill() {
+    if (stream == nullptr || !getline(*stream, line)) {
+        return false;
+    }
+    rest = line;
+    return true;
+}
@@ -0,0 +1,30 @@
+#ifndef CSXD_TOKENIZER_H
+#define CSXD_TOKENIZER_H
+
+
+#include <string>
+#include <string_view>
+#include <istream>
+
+using namespace std;
+
+class Tokenizer {
+public:
+    explicit Tokenizer(istream& stream);
+    explicit Tokenizer(string_view buffer);
+
+    void reset(istream& stream);
+    void reset(string_view buffer);
+    string_view next();
+    uint next_uint();
+
+private:
+    bool refill();
+
+    istream* stream;
+    string line;
+    string_view rest;
+};
+
+
+#endif //CSXD_TOKENIZER_H
@@ -0,0 +1,106 @@
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "Trace.h"
+
+namespace {
+
+mutex buffers_mutex;
+
+/// Buffers outlive their threads, so spans of finished workers are still written
+vector<unique_ptr<TraceBuffer>>& get_buffers() {
+    static vector<unique_ptr<TraceBuffer>> buffers;
+    return buffers;
+}
+
+}
+
+TraceBuffer::TraceBuffer(size_t capacity, uint thread_id) : events(make_unique<Event[]>(capacity)), capacity(capacity), next(0), size(0), thread_id(thread_id) {
+    if (capacity == 0) {
+        throw out_of_range("capacity should be more than 0");
+    }
+}
+
+const TraceBuffer::Event& TraceBuffer::get_event(size_t i) const {
+    if (i >= size) {
+        throw out_of_range("i should be less than the size");
+    }
+    size_t oldest = size < capacity ? 0 : next;
+    return events[(oldest + i) % capacity];
+}
+
+size_t TraceBuffer::get_size() const {
+    return size;
+}
+
+size_t TraceBuffer::get_capacity() const {
+    return capacity;
+}
+
+uint TraceBuffer::get_thread_id() const {
+    return thread_id;
+}
+
+void TraceBuffer::clear() {
+    next = 0;
+    size = 0;
+}
+
+/// Allocates and registers the calling thread's buffer the first time it records
+TraceBuffer& Trace::get_thread_buffer() {
+    thread_local TraceBuffer* buffer = nullptr;
+    if (buffer == nullptr) {
+        lock_guard<mutex> lock(buffers_mutex);
+        auto& buffers = get_buffers();
+        buffers.push_back(make_unique<TraceBuffer>(BUFFER_CAPACITY, buffers.size() + 1));
+        buffer = buffers.back().get();
+    }
+    return *buffer;
+}
+
+/// Complete ("X") events with timestamps in microseconds since the earliest recorded span started. Spans are recorded
+/// when they end, so an enclosing span comes after the spans inside it.
+void Trace::write_json(ostream& stream) {
+    lock_guard<mutex> lock(buffers_mutex);
+    ull epoch = numeric_limits<ull>::max();
+    for (const auto& buffer : get_buffers()) {
+        for (size_t i = 0; i < buffer->get_size(); i++) {
+            epoch = min(epoch, buffer->get_event(i).start);
+        }
+    }
+
+    auto flags = stream.flags();
+    auto precision = stream.precision();
+    stream << fixed << setprecision(3) << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : get_buffers()) {
+        for (size_t i = 0; i < buffer->get_size(); i++) {
+            const TraceBuffer::Event& event = buffer->get_event(i);
+            stream << (first ? "\n" : ",\n") << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"ts\":"
+                   << (event.start - epoch) / 1000.0 << ",\"dur\":" << event.duration / 1000.0
+                   << ",\"pid\":1,\"tid\":" << buffer->get_thread_id() << "}";
+            first = false;
+        }
+    }
+    stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+void Trace::clear() {
+    lock_guard<mutex> lock(buffers_mutex);
+    for (const auto& buffer : get_buffers()) {
+        buffer->clear();
+    }
+}
+
+bool Trace::is_enabled() {
+#ifdef CSXD_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,113 @@
+#ifndef CSXD_TRACE_H
+#define CSXD_TRACE_H
+
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Fixed-size ring of the spans one thread recorded. Once full, every new span overwrites the oldest one, so recording
+/// never allocates. Not thread-safe; only its own thread records into it.
+class TraceBuffer {
+public:
+    struct Event {
+        const char* name;
+        ull start;
+        ull duration;
+    };
+
+    TraceBuffer(size_t capacity, uint thread_id);
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+    void record(const char* name, ull start, ull duration) {
+        events[next] = {name, start, duration};
+        next = next + 1 == capacity ? 0 : next + 1;
+        if (size < capacity) {
+            size++;
+        }
+    }
+
+    /// The i-th oldest span still in the buffer
+    const Event& get_event(size_t i) const;
+    size_t get_size() const;
+    size_t get_capacity() const;
+    uint get_thread_id() const;
+    void clear();
+
+private:
+    unique_ptr<Event[]> events;
+    size_t capacity;
+    size_t next;
+    size_t size;
+    uint thread_id;
+};
+
+/// Spans of match execution in the Chrome trace-event format, which chrome://tracing and Perfetto open. Every thread
+/// records into its own TraceBuffer, allocated the first time it records. Span names must be string literals, since
+/// only the pointer is kept. write_json() and clear() must only be called while no thread is recording.
+class Trace {
+public:
+    /// Spans kept per thread; the most recent ones win
+    static constexpr size_t BUFFER_CAPACITY = 1 << 16;
+
+    static ull now() {
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void record(const char* name, ull start) {
+        get_thread_buffer().record(name, start, now() - start);
+    }
+
+    static TraceBuffer& get_thread_buffer();
+    static void write_json(ostream& stream);
+    static void clear();
+    /// Whether the CSXD_TRACE macros record anything in this build
+    static bool is_enabled();
+};
+
+/// Records the span from its construction to end() or its destruction, whichever comes first
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name) : name(name), start(Trace::now()), ended(false) {}
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    ~TraceSpan() {
+        end();
+    }
+
+    void end() {
+        if (!ended) {
+            Trace::record(name, start);
+            ended = true;
+        }
+    }
+
+private:
+    const char* name;
+    ull start;
+    bool ended;
+};
+
+/// CSXD_TRACE_SPAN(name) traces until the end of the enclosing scope. CSXD_TRACE_BEGIN(span) and CSXD_TRACE_END(span)
+/// trace the statements in between as a span named span, ended at the end of the scope if CSXD_TRACE_END is not
+/// reached. Unless built with CSXD_TRACING, they compile to nothing.
+#ifdef CSXD_TRACING
+#define CSXD_TRACE_CONCAT_INNER(a, b) a##b
+#define CSXD_TRACE_CONCAT(a, b) CSXD_TRACE_CONCAT_INNER(a, b)
+#define CSXD_TRACE_SPAN(name) TraceSpan CSXD_TRACE_CONCAT(csxd_trace_span_, __LINE__)(name)
+#define CSXD_TRACE_BEGIN(span) TraceSpan csxd_trace_##span(#span)
+#define CSXD_TRACE_END(span) csxd_trace_##span.end()
+#else
+#define CSXD_TRACE_SPAN(name) static_cast<void>(0)
+#define CSXD_TRACE_BEGIN(span) static_cast<void>(0)
+#define CSXD_TRACE_END(span) static_cast<void>(0)
+#endif
+
+
+#endif //CSXD_TRACE_H
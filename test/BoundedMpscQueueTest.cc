@@ -0,0 +1,78 @@
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "server/BoundedMpscQueue.h"
+
+typedef unsigned long long ull;
+
+TEST(BoundedMpscQueueTest, CapacityAssertions) {
+    EXPECT_THROW(BoundedMpscQueue<int>(0), out_of_range);
+    EXPECT_EQ(BoundedMpscQueue<int>(1).get_capacity(), 1);
+    EXPECT_EQ(BoundedMpscQueue<int>(5).get_capacity(), 8);
+    EXPECT_EQ(BoundedMpscQueue<int>(64).get_capacity(), 64);
+}
+
+TEST(BoundedMpscQueueTest, FirstInFirstOutAssertions) {
+    BoundedMpscQueue<int> queue(4);
+    int value = 0;
+    EXPECT_FALSE(queue.try_pop(value));
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 4; i++) {
+            value = round * 10 + i;
+            EXPECT_TRUE(queue.try_push(value));
+        }
+        value = -1;
+        EXPECT_FALSE(queue.try_push(value));
+        EXPECT_EQ(value, -1);
+
+        for (int i = 0; i < 4; i++) {
+            ASSERT_TRUE(queue.try_pop(value));
+            EXPECT_EQ(value, round * 10 + i);
+        }
+        EXPECT_FALSE(queue.try_pop(value));
+    }
+}
+
+TEST(BoundedMpscQueueTest, ManyProducersAssertions) {
+    const ull producer_count = 4;
+    const ull values_per_producer = 20000;
+    BoundedMpscQueue<ull> queue(64);
+
+    vector<thread> producers;
+    for (ull producer = 0; producer < producer_count; producer++) {
+        producers.emplace_back([&queue, producer] {
+            for (ull i = 0; i < values_per_producer; i++) {
+                ull value = producer << 32 | i;
+                while (!queue.try_push(value)) {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+
+    vector<ull> next_values(producer_count, 0);
+    for (ull popped = 0; popped < producer_count * values_per_producer;) {
+        ull value;
+        if (!queue.try_pop(value)) {
+            this_thread::yield();
+            continue;
+        }
+        ull producer = value >> 32;
+        ASSERT_LT(producer, producer_count);
+        EXPECT_EQ(value & 0xFFFFFFFF, next_values[producer]++);
+        popped++;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    ull value;
+    EXPECT_FALSE(queue.try_pop(value));
+    for (ull producer = 0; producer < producer_count; producer++) {
+        EXPECT_EQ(next_values[producer], values_per_producer);
+    }
+}
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "utils/generator/MatchGenerator.h"
+#include "utils/matchlog/MatchLogFormat.h"
+#include "server/BulkReplayer.h"
+#include "helpers/TextMatch.h"
+
+namespace {
+
+string read_file(const filesystem::path& path) {
+    ifstream file(path, ios::binary);
+    return string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+filesystem::path make_temporary_directory(const string& name) {
+    auto directory = get_temporary_path(name);
+    filesystem::remove_all(directory);
+    filesystem::create_directories(directory / "matches");
+    return directory;
+}
+
+}
+
+TEST(BulkReplayerTest, ConstructionOutOfRangeAssertions) {
+    EXPECT_THROW(BulkReplayer(0, "output"), out_of_range);
+}
+
+TEST(BulkReplayerTest, ReplaysDirectoryAssertions) {
+    Data::load();
+    auto directory = make_temporary_directory("csxd_bulk_replayer_directory");
+
+    vector<string> expected_outputs;
+    for (ull seed = 1; seed <= 6; seed++) {
+        MatchGeneratorOptions options;
+        options.rounds = 3;
+        options.commands_per_round = 50;
+        options.invalid_ratio = 0.1;
+        options.seed = seed;
+        string input = MatchGenerator(options).generate();
+
+        auto path = directory / "matches" / ("match" + to_string(seed));
+        ofstream file(path, ios::binary);
+        if (seed % 2 == 0) {
+            expected_outputs.push_back(play_text_match(input, &file));
+        }
+        else {
+            file << input;
+            expected_outputs.push_back(play_text_match(input));
+        }
+    }
+
+    BulkReplayer replayer(3, (directory / "output").string());
+    auto paths = BulkReplayer::list_directory((directory / "matches").string());
+    auto stats = replayer.replay(paths);
+
+    ASSERT_EQ(paths.size(), 6);
+    EXPECT_EQ(stats.matches, 6);
+    EXPECT_EQ(stats.failed_matches, 0);
+    EXPECT_EQ(stats.commands, 6 * (2 * 5 + 3 * 50));
+
+    for (size_t i = 0; i < paths.size(); i++) {
+        auto output = directory / "output" / (to_string(i) + "-" + filesystem::path(paths[i]).filename().string() + ".out");
+        EXPECT_EQ(read_file(output), expected_outputs[i]);
+
+        const auto& summary = replayer.get_summaries()[i];
+        EXPECT_EQ(summary.path, paths[i]);
+        EXPECT_FALSE(summary.failed);
+        EXPECT_EQ(summary.counter_terrorist_round_wins + summary.terrorist_round_wins, 3);
+    }
+
+    ostringstream summaries;
+    replayer.write_summaries(summaries);
+    string summary_lines = summaries.str();
+    EXPECT_EQ(count(summary_lines.begin(), summary_lines.end(), '\n'), 7);
+
+    filesystem::remove_all(directory);
+}
+
+TEST(BulkReplayerTest, ReplaysManifestAssertions) {
+    Data::load();
+    auto directory = make_temporary_directory("csxd_bulk_replayer_manifest");
+
+    string valid_input = "1\nROUND 1\nADD-USER A terrorist 00:01:000\n";
+    ofstream(directory / "matches" / "valid") << valid_input;
+    ofstream(directory / "matches" / "truncated", ios::binary) << string(MATCH_LOG_MAGIC, sizeof(MATCH_LOG_MAGIC));
+    ofstream(directory / "manifest") << "matches/valid\n\nmatches/truncated\nmatches/missing\n";
+
+    auto paths = BulkReplayer::read_manifest((directory / "manifest").string());
+    ASSERT_EQ(paths.size(), 3);
+    EXPECT_EQ(filesystem::path(paths[0]), directory / "matches" / "valid");
+
+    BulkReplayer replayer(2, (directory / "output").string());
+    auto stats = replayer.replay(paths);
+
+    EXPECT_EQ(stats.matches, 3);
+    EXPECT_EQ(stats.failed_matches, 2);
+    EXPECT_EQ(stats.commands, 1);
+    EXPECT_FALSE(replayer.get_summaries()[0].failed);
+    EXPECT_EQ(replayer.get_summaries()[0].counter_terrorist_round_wins + replayer.get_summaries()[0].terrorist_round_wins, 1);
+    EXPECT_TRUE(replayer.get_summaries()[1].failed);
+    EXPECT_TRUE(replayer.get_summaries()[2].failed);
+    EXPECT_EQ(read_file(directory / "output" / "0-valid.out"), play_text_match(valid_input));
+
+    filesystem::remove_all(directory);
+}
+
+TEST(BulkReplayerTest, UnwritableOutputAssertions) {
+    Data::load();
+    auto directory = make_temporary_directory("csxd_bulk_replayer_unwritable_output");
+
+    string input = "1\nROUND 1\nADD-USER A Terrorist 00:01:000\n";
+    ofstream(directory / "matches" / "valid") << input;
+    ofstream(directory / "matches" / "blocked") << input;
+    filesystem::create_directories(directory / "output" / "0-blocked.out");
+
+    BulkReplayer replayer(2, (directory / "output").string());
+    auto stats = replayer.replay(BulkReplayer::list_directory((directory / "matches").string()));
+
+    EXPECT_EQ(stats.failed_matches, 1);
+    EXPECT_TRUE(replayer.get_summaries()[0].failed);
+    EXPECT_NE(replayer.get_summaries()[0].error.find("0-blocked.out"), string::npos);
+    EXPECT_FALSE(replayer.get_summaries()[1].failed);
+    EXPECT_EQ(read_file(replayer.get_summaries()[1].output_path), play_text_match(input));
+
+    filesystem::remove_all(directory);
+}
+
+TEST(BulkReplayerTest, SameFileNameAssertions) {
+    Data::load();
+    auto directory = make_temporary_directory("csxd_bulk_replayer_same_name");
+
+    string first_input = "1\nROUND 1\nADD-USER A Terrorist 00:01:000\n";
+    string second_input = "1\nROUND 1\nADD-USER B Counter-Terrorist 00:01:000\n";
+    filesystem::create_directories(directory / "matches" / "first");
+    filesystem::create_directories(directory / "matches" / "second");
+    ofstream(directory / "matches" / "first" / "match") << first_input;
+    ofstream(directory / "matches" / "second" / "match") << second_input;
+    ofstream(directory / "manifest") << "matches/first/match\nmatches/second/match\n";
+
+    BulkReplayer replayer(2, (directory / "output").string());
+    auto stats = replayer.replay(BulkReplayer::read_manifest((directory / "manifest").string()));
+
+    EXPECT_EQ(stats.failed_matches, 0);
+    EXPECT_NE(replayer.get_summaries()[0].output_path, replayer.get_summaries()[1].output_path);
+    EXPECT_EQ(read_file(replayer.get_summaries()[0].output_path), play_text_match(first_input));
+    EXPECT_EQ(read_file(replayer.get_summaries()[1].output_path), play_text_match(second_input));
+    EXPECT_NE(play_text_match(first_input), play_text_match(second_input));
+
+    filesystem::remove_all(directory);
+}
@@ -0,0 +1,77 @@
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+
+#include "utils/data/Data.h"
+#include "utils/metrics/CommandLatencies.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+
+TEST(CommandLatenciesTest, SamplingAssertions) {
+    EXPECT_THROW(CommandLatencies(0), out_of_range);
+
+    CommandLatencies latencies(4);
+    int sampled = 0;
+    for (int i = 0; i < 20; i++) {
+        sampled += latencies.should_sample();
+    }
+
+    EXPECT_EQ(latencies.get_sample_period(), 4);
+    EXPECT_EQ(sampled, 5);
+}
+
+TEST(CommandLatenciesTest, InteractionsAssertions) {
+    Data::load();
+    string input = "2\n"
+                   "ROUND 4\n"
+                   "ADD-USER Player Terrorist 00:01:000\n"
+                   "ADD-USER Other Counter-Terrorist 00:01:000\n"
+                   "GET-MONEY Player 00:02:000\n"
+                   "TAP Player Other knife 00:05:000\n"
+                   "ROUND 1\n"
+                   "SCORE-BOARD 00:10:000\n";
+    ostringstream output;
+    CommandLatencies latencies(1);
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output);
+    interactions.set_latencies(&latencies);
+    interactions.init();
+    interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds()));
+    interactions.begin();
+
+    EXPECT_EQ(latencies.get_histogram(ADD_USER).get_count(), 2);
+    EXPECT_EQ(latencies.get_histogram(GET_HEALTH).get_count(), 0);
+    EXPECT_EQ(latencies.get_histogram(GET_MONEY).get_count(), 1);
+    EXPECT_EQ(latencies.get_histogram(BUY).get_count(), 0);
+    EXPECT_EQ(latencies.get_histogram(TAP).get_count(), 1);
+    EXPECT_EQ(latencies.get_histogram(SCORE_BOARD).get_count(), 1);
+    EXPECT_EQ(latencies.get_round_end_histogram().get_count(), 2);
+}
+
+TEST(CommandLatenciesTest, DumpAssertions) {
+    CommandLatencies latencies(1);
+    latencies.record(TAP, 100);
+    latencies.record(TAP, 300);
+    CommandLatencies other(1);
+    other.record(BUY, 50);
+    latencies.merge(other);
+
+    ostringstream text;
+    latencies.write_text(text);
+    ostringstream json_stream;
+    latencies.write_json(json_stream);
+    auto json = nlohmann::json::parse(json_stream.str());
+
+    EXPECT_NE(text.str().find("ROUND-END"), string::npos);
+    EXPECT_NE(text.str().find("TAP"), string::npos);
+    EXPECT_EQ(json["unit"], "ns");
+    EXPECT_EQ(json["sample_period"], 1);
+    EXPECT_EQ(json["commands"]["TAP"]["count"], 2);
+    EXPECT_EQ(json["commands"]["TAP"]["max"], 300);
+    EXPECT_EQ(json["commands"]["TAP"]["buckets"].size(), 2);
+    EXPECT_EQ(json["commands"]["BUY"]["min"], 50);
+    EXPECT_EQ(json["commands"]["ADD-USER"]["count"], 0);
+}
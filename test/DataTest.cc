@@ -0,0 +1,68 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "exceptions/WeaponNotFoundException.h"
+#include "helpers/TextMatch.h"
+
+namespace {
+
+void expect_same_weapon(const shared_ptr<Weapon>& weapon, const shared_ptr<Weapon>& expected) {
+    ASSERT_NE(weapon, nullptr);
+    EXPECT_EQ(weapon->get_name(), expected->get_name());
+    EXPECT_EQ(weapon->get_price(), expected->get_price());
+    EXPECT_EQ(weapon->get_damage_per_hit(), expected->get_damage_per_hit());
+    EXPECT_EQ(weapon->get_money_per_kill(), expected->get_money_per_kill());
+    EXPECT_EQ(weapon->get_type(), expected->get_type());
+    for (auto side : {COUNTER_TERRORIST, TERRORIST, ALL}) {
+        EXPECT_EQ(weapon->is_available_for(side), expected->is_available_for(side));
+    }
+}
+
+}
+
+TEST(DataTest, CompiledWeaponsAssertions) {
+    const string names[] = {"AK", "AWP", "Desert-Eagle", "Glock-18", "Knife", "M4A1", "Revolver", "UPS-S"};
+
+    Data::load((filesystem::path(__FILE__).parent_path() / "../src/weapons.json").string());
+    vector<shared_ptr<Weapon>> loaded_weapons;
+    for (const auto& name : names) {
+        loaded_weapons.push_back(Data::get_weapon_by_name(name));
+    }
+
+    Data::load();
+    for (size_t i = 0; i < size(names); i++) {
+        expect_same_weapon(Data::get_weapon_by_name(names[i]), loaded_weapons[i]);
+        EXPECT_EQ(Data::get_weapon_by_name(names[i]), Data::get_weapon_by_name(names[i]));
+    }
+    EXPECT_EQ(Data::try_get_weapon_by_name("Ak"), nullptr);
+    EXPECT_EQ(Data::try_get_weapon_by_name(""), nullptr);
+    EXPECT_EQ(Data::try_get_weapon_by_name("Zeus"), nullptr);
+    EXPECT_THROW(Data::get_weapon_by_name("Zeus"), WeaponNotFoundException);
+}
+
+TEST(DataTest, CustomWeaponsAssertions) {
+    auto path = get_temporary_path("csxd_custom_weapons.json").string();
+    ofstream(path) << R"([{"name": "Zeus", "price": 200, "damage_per_hit": 100, "money_per_kill": 0, )"
+                      R"("type": "pistol", "available_for": "all"}])";
+
+    auto compiled_knife = Data::get_weapon_by_name("Knife");
+    Data::load(path);
+
+    auto zeus = Data::get_weapon_by_name("Zeus");
+    EXPECT_EQ(zeus->get_price(), 200);
+    EXPECT_EQ(zeus->get_type(), PISTOL);
+    EXPECT_TRUE(zeus->is_available_for(ALL));
+    EXPECT_EQ(Data::try_get_weapon_by_name("AK"), nullptr);
+    EXPECT_EQ(compiled_knife->get_name(), "Knife");
+    EXPECT_THROW(Data::load(path + ".missing"), invalid_argument);
+
+    Data::load();
+    EXPECT_EQ(Data::try_get_weapon_by_name("Zeus"), nullptr);
+    EXPECT_EQ(Data::get_weapon_by_name("Knife"), compiled_knife);
+
+    filesystem::remove(path);
+}
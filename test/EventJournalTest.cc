@@ -0,0 +1,321 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "utils/generator/MatchGenerator.h"
+#include "utils/journal/EventJournal.h"
+#include "utils/journal/EventJournalReader.h"
+#include "utils/parser/MappedFile.h"
+#include "helpers/TextMatch.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+
+namespace {
+
+string generate_match(ull seed) {
+    MatchGeneratorOptions options;
+    options.rounds = 12;
+    options.commands_per_round = 80;
+    options.invalid_ratio = 0.1;
+    options.seed = seed;
+    return MatchGenerator(options).generate();
+}
+
+/// State of the game at a round boundary, ignoring the round time the last command left behind
+string take_boundary_snapshot(const GamePlay& game_play) {
+    string snapshot;
+    game_play.take_snapshot(snapshot);
+    GamePlay copy(1);
+    copy.restore_snapshot(snapshot);
+    copy.set_round_time(0);
+    copy.take_snapshot(snapshot);
+    return snapshot;
+}
+
+/// Plays the match round by round, keeping the journal size and the game state after each round
+void play_journaled(const string& input, uint rounds_per_snapshot, ostringstream& journal_stream,
+                    vector<size_t>& journal_sizes, vector<string>& snapshots) {
+    ostringstream output;
+    EventJournal journal(journal_stream);
+    auto game_play = make_shared<GamePlay>(12);
+    game_play->set_journal(&journal, rounds_per_snapshot);
+
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output);
+    interactions.init();
+    interactions.set_game_play(game_play);
+    while (!interactions.has_ended()) {
+        interactions.play_round();
+        journal_sizes.push_back(journal_stream.str().size());
+        snapshots.push_back(take_boundary_snapshot(*game_play));
+    }
+}
+
+string recover(string_view journal) {
+    GamePlay game_play(12);
+    game_play.recover(journal);
+    return take_boundary_snapshot(game_play);
+}
+
+}
+
+TEST(EventJournalTest, RecordsAssertions) {
+    ostringstream journal_stream;
+    EventJournal journal(journal_stream);
+
+    journal.player_added("Player", TERRORIST, 1500, 100, 10000, 1000);
+    journal.weapon_equipped(0, "Knife");
+    journal.damage_taken(3, 43);
+    EXPECT_GT(journal.get_pending_size(), 0);
+    journal.commit();
+    EXPECT_EQ(journal.get_pending_size(), 0);
+    journal.kill_added(1);
+    journal.money_changed(1, 1500);
+    journal.weapon_dropped(2, HEAVY);
+    journal.round_ended(COUNTER_TERRORIST);
+    journal.snapshot("state");
+    journal.commit();
+    EXPECT_EQ(journal.get_commit_count(), 2);
+
+    string contents = journal_stream.str();
+    EventJournalReader reader(contents);
+    JournalFrame frame;
+    JournalEvent event;
+    size_t position = 0;
+
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ(frame.type, EVENTS_FRAME);
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.type, PLAYER_ADDED);
+    EXPECT_EQ(event.name, "Player");
+    EXPECT_EQ(event.side, TERRORIST);
+    EXPECT_EQ(event.entry_time, 1500);
+    EXPECT_EQ(event.value, 100);
+    EXPECT_EQ(event.max_money, 10000);
+    EXPECT_EQ(event.money, 1000);
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.type, WEAPON_EQUIPPED);
+    EXPECT_EQ(event.player, 0);
+    EXPECT_EQ(event.name, "Knife");
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.type, DAMAGE_TAKEN);
+    EXPECT_EQ(event.player, 3);
+    EXPECT_EQ(event.value, 43);
+    EXPECT_FALSE(EventJournalReader::next_event(frame.payload, position, event));
+
+    ASSERT_TRUE(reader.next(frame));
+    position = 0;
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.type, KILL_ADDED);
+    EXPECT_EQ(event.player, 1);
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.type, MONEY_CHANGED);
+    EXPECT_EQ(event.value, 1500);
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.type, WEAPON_DROPPED);
+    EXPECT_EQ(event.weapon_type, HEAVY);
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.type, ROUND_ENDED);
+    EXPECT_EQ(event.side, COUNTER_TERRORIST);
+
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ(frame.type, SNAPSHOT_FRAME);
+    EXPECT_EQ(frame.payload, "state");
+    EXPECT_FALSE(reader.next(frame));
+    EXPECT_FALSE(reader.has_torn_tail());
+
+    EventJournalReader torn_reader(string_view(contents).substr(0, contents.size() - 1));
+    EXPECT_TRUE(torn_reader.next(frame));
+    EXPECT_TRUE(torn_reader.next(frame));
+    EXPECT_FALSE(torn_reader.next(frame));
+    EXPECT_TRUE(torn_reader.has_torn_tail());
+
+    EXPECT_THROW(EventJournalReader("CSXS"), invalid_argument);
+}
+
+TEST(EventJournalTest, RecoverAssertions) {
+    Data::load();
+    for (uint rounds_per_snapshot : {0u, 1u, 5u}) {
+        string input = generate_match(rounds_per_snapshot + 3);
+        ostringstream journal_stream;
+        vector<size_t> journal_sizes;
+        vector<string> snapshots;
+        play_journaled(input, rounds_per_snapshot, journal_stream, journal_sizes, snapshots);
+        string journal = journal_stream.str();
+
+        ASSERT_EQ(snapshots.size(), 12);
+        EXPECT_EQ(recover(journal), snapshots.back());
+
+        for (size_t round = 1; round < snapshots.size(); round++) {
+            EXPECT_EQ(recover(string_view(journal).substr(0, journal_sizes[round])), snapshots[round]);
+            EXPECT_EQ(recover(string_view(journal).substr(0, journal_sizes[round - 1] + 3)), snapshots[round - 1]);
+        }
+    }
+}
+
+TEST(EventJournalTest, RecoverFromFileAssertions) {
+    Data::load();
+    auto path = get_temporary_path("csxd_event_journal_test").string();
+    filesystem::remove(path);
+
+    string expected;
+    {
+        EventJournal journal(path);
+        GamePlay game_play(3);
+        game_play.set_journal(&journal, 2);
+        PlayerHandle terrorist = game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+        game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+        game_play.buy_weapon(terrorist, Data::get_weapon_by_name("Revolver"));
+        game_play.determine_winner_and_go_next_round();
+        game_play.attack_occurred("Counter-Terrorist", "Terrorist", MELEE);
+        game_play.determine_winner_and_go_next_round();
+        game_play.attack_occurred("Counter-Terrorist", "Terrorist", MELEE);
+        expected = take_boundary_snapshot(game_play);
+        EXPECT_EQ(journal.get_commit_count(), 2);
+    }
+    {
+        EventJournal journal(path, true);
+        GamePlay game_play(3);
+        game_play.set_journal(&journal, 2);
+        game_play.recover(MappedFile(path).get_contents());
+        game_play.attack_occurred("Counter-Terrorist", "Terrorist", MELEE);
+        game_play.determine_winner_and_go_next_round();
+        expected = take_boundary_snapshot(game_play);
+    }
+
+    GamePlay game_play(3);
+    game_play.recover(MappedFile(path).get_contents());
+    EXPECT_EQ(take_boundary_snapshot(game_play), expected);
+    EXPECT_TRUE(game_play.has_ended());
+
+    filesystem::remove(path);
+}
+
+TEST(EventJournalTest, RecoverAcrossCatalogChangeAssertions) {
+    auto path = get_temporary_path("csxd_journaled_weapons.json").string();
+    ofstream(path) << R"([{"name": "Knife", "price": 0, "damage_per_hit": 50, "money_per_kill": 500, )"
+                      R"("type": "knife", "available_for": "all"}, )"
+                      R"({"name": "Zeus", "price": 200, "damage_per_hit": 100, "money_per_kill": 0, )"
+                      R"("type": "pistol", "available_for": "all"}])";
+
+    Data::load();
+    ostringstream journal_stream;
+    EventJournal journal(journal_stream);
+    GamePlay game_play(5);
+    game_play.set_journal(&journal);
+    PlayerHandle terrorist = game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+    PlayerHandle counter_terrorist = game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+    game_play.buy_weapon(terrorist, game_play.get_weapon_by_name("Revolver"));
+    game_play.determine_winner_and_go_next_round();
+    Data::load(path);
+    game_play.determine_winner_and_go_next_round();
+    game_play.buy_weapon(counter_terrorist, game_play.get_weapon_by_name("Zeus"));
+    game_play.attack_occurred(counter_terrorist, terrorist, PISTOL);
+    game_play.determine_winner_and_go_next_round();
+    string expected = take_boundary_snapshot(game_play);
+
+    GamePlay recovered(5);
+    recovered.recover(journal_stream.str());
+    EXPECT_EQ(take_boundary_snapshot(recovered), expected);
+    EXPECT_EQ(recovered.get_player_handle("Terrorist"), terrorist);
+
+    Data::load();
+    filesystem::remove(path);
+}
+
+TEST(EventJournalTest, ReopenReplacesJournalAssertions) {
+    auto path = get_temporary_path("csxd_reopened_event_journal_test").string();
+    filesystem::remove(path);
+    {
+        EventJournal journal(path);
+        journal.kill_added(1);
+        journal.commit();
+    }
+    {
+        EventJournal journal(path);
+        journal.kill_added(2);
+        journal.commit();
+    }
+
+    MappedFile file(path);
+    EventJournalReader reader(file.get_contents());
+    JournalFrame frame;
+    JournalEvent event;
+    size_t position = 0;
+    ASSERT_TRUE(reader.next(frame));
+    ASSERT_TRUE(EventJournalReader::next_event(frame.payload, position, event));
+    EXPECT_EQ(event.player, 2);
+    EXPECT_FALSE(reader.next(frame));
+    EXPECT_FALSE(reader.has_torn_tail());
+
+    filesystem::remove(path);
+}
+
+TEST(EventJournalTest, InvalidEnumeratorsAssertions) {
+    for (uint side : {0, 3, 4}) {
+        for (bool round_ended : {false, true}) {
+            ostringstream journal_stream;
+            EventJournal journal(journal_stream);
+            if (round_ended) {
+                journal.round_ended(static_cast<Side>(side));
+            }
+            else {
+                journal.player_added("Player", static_cast<Side>(side), 0, 100, 10000, 1000);
+            }
+            journal.commit();
+
+            string contents = journal_stream.str();
+            EventJournalReader reader(contents);
+            JournalFrame frame;
+            JournalEvent event;
+            size_t position = 0;
+            ASSERT_TRUE(reader.next(frame));
+            EXPECT_THROW(EventJournalReader::next_event(frame.payload, position, event), invalid_argument);
+        }
+    }
+
+    for (uint weapon_type : {0, 3, 8}) {
+        ostringstream journal_stream;
+        EventJournal journal(journal_stream);
+        journal.weapon_dropped(0, static_cast<WeaponType>(weapon_type));
+        journal.commit();
+
+        string contents = journal_stream.str();
+        EventJournalReader reader(contents);
+        JournalFrame frame;
+        JournalEvent event;
+        size_t position = 0;
+        ASSERT_TRUE(reader.next(frame));
+        EXPECT_THROW(EventJournalReader::next_event(frame.payload, position, event), invalid_argument);
+    }
+}
+
+TEST(EventJournalTest, FrameChecksumAssertions) {
+    ostringstream journal_stream;
+    EventJournal journal(journal_stream);
+    journal.kill_added(1);
+    journal.commit();
+    size_t first_frame_end = journal_stream.str().size();
+    journal.snapshot("state");
+    string contents = journal_stream.str();
+    JournalFrame frame;
+
+    string corrupt_first = contents;
+    corrupt_first[first_frame_end - 5] ^= 1;
+    EventJournalReader corrupt_first_reader(corrupt_first);
+    EXPECT_THROW(corrupt_first_reader.next(frame), invalid_argument);
+
+    string corrupt_last = contents;
+    corrupt_last[contents.find("state")] = 'S';
+    EventJournalReader corrupt_last_reader(corrupt_last);
+    EXPECT_TRUE(corrupt_last_reader.next(frame));
+    EXPECT_FALSE(corrupt_last_reader.next(frame));
+    EXPECT_TRUE(corrupt_last_reader.has_torn_tail());
+}
@@ -1,10 +1,18 @@
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory_resource>
+#include <sstream>
+
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
 #include "utils/data/Data.h"
+#include "utils/journal/EventJournal.h"
 #include "mocks/MockWeapon.h"
 #include "mocks/MockPlayer.h"
 #include "mocks/MockGame.h"
+#include "helpers/TextMatch.h"
 #include "GamePlay.h"
 #include "exceptions/ActionAtIllegalTimeException.h"
 #include "exceptions/ActionFromDeadPlayerException.h"
@@ -22,7 +30,9 @@
 #include "exceptions/WeaponOfThisTypeAlreadyEquippedException.h"
 
 using ::testing::Return;
+using ::testing::ReturnRefOfCopy;
 using ::testing::Throw;
+using ::testing::ReturnRef;
 using ::testing::ElementsAreArray;
 
 TEST(GamePlayTest, SetRoundTimeAssertions) {
@@ -49,7 +59,7 @@ TEST(GamePlayTest, CreatePlayerAssertions) {
     EXPECT_EQ(player->get_entry_time(), 0);
     EXPECT_EQ(player->get_max_money(), 10000);
     EXPECT_EQ(player->get_money(), 1000);
-    EXPECT_EQ(player->get_weapon(MELEE), Data::get_weapon_by_name("Knife"));
+    EXPECT_EQ(player->get_weapon(MELEE), Data::get_weapon_by_name("Knife").get());
 }
 
 TEST(GamePlayTest, CreatePlayerAfterTimeLimitAssertions) {
@@ -79,9 +89,9 @@ TEST(GamePlayTest, AddPlayerAssertions) {
 
     EXPECT_CALL(*mock_player, get_name)
         .Times(2)
-        .WillRepeatedly(Return("Player"));
+        .WillRepeatedly(ReturnRefOfCopy(string("Player")));
     EXPECT_CALL(*mock_player, get_side)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(TERRORIST));
 
     game_play.add_player(mock_player);
@@ -99,7 +109,7 @@ TEST(GamePlayTest, AddSamePlayerTwiceAssertions) {
     auto mock_player2 = make_shared<MockPlayer>();
 
     EXPECT_CALL(*mock_player1, get_side)
-        .Times(5)
+        .Times(4)
         .WillRepeatedly(Return(TERRORIST));
     EXPECT_CALL(*mock_player2, get_side)
         .Times(2)
@@ -180,11 +190,11 @@ TEST(GamePlayTest, BuyWeaponPlayerAssertions) {
         .WillOnce(Return(true));
     EXPECT_CALL(*mock_player, get_side)
         .WillOnce(Return(TERRORIST));
-    EXPECT_CALL(*mock_player, get_weapon(weapon->get_type()))
-        .WillOnce(Throw(WeaponNotEquippedException()));
-    EXPECT_CALL(*mock_player, subtract_money(weapon->get_price()))
-        .WillOnce(Return());
-    EXPECT_CALL(*mock_player, equip_weapon(weapon))
+    EXPECT_CALL(*mock_player, find_weapon(weapon->get_type()))
+        .WillOnce(Return(nullptr));
+    EXPECT_CALL(*mock_player, try_subtract_money(weapon->get_price()))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mock_player, equip_weapon(weapon.get()))
         .WillOnce(Return());
 
     game_play.buy_weapon("", weapon);
@@ -240,13 +250,13 @@ TEST(GamePlayTest, BuyWeaponAfterTimeLimitAssertions) {
 
     ON_CALL(*mock_game, get_round_time)
         .WillByDefault(Return(45 * 1000));
-    ON_CALL(*mock_game, get_player_by_name)
+    ON_CALL(*mock_game, find_player_by_name)
         .WillByDefault(Return(mock_player));
 
     ON_CALL(*mock_player, is_alive)
         .WillByDefault(Return(true));
-    ON_CALL(*mock_player, get_weapon)
-        .WillByDefault(Throw(WeaponNotEquippedException()));
+    ON_CALL(*mock_player, find_weapon)
+        .WillByDefault(Return(nullptr));
 
     ON_CALL(*mock_weapon, is_available_for)
         .WillByDefault(Return(true));
@@ -303,8 +313,8 @@ TEST(GamePlayTest, BuyWeaponAlreadyEquippedAssertions) {
 
     game_play.add_player(mock_player);
 
-    EXPECT_CALL(*mock_player, get_weapon)
-        .WillOnce(Return(mock_weapon));
+    EXPECT_CALL(*mock_player, find_weapon)
+        .WillOnce(Return(mock_weapon.get()));
 
     EXPECT_THROW(game_play.buy_weapon("", mock_weapon), WeaponOfThisTypeAlreadyEquippedException);
 }
@@ -318,8 +328,8 @@ TEST(GamePlayTest, BuyWeaponNoMoneyAssertions) {
         .WillByDefault(Return(TERRORIST));
     ON_CALL(*mock_player, is_alive)
         .WillByDefault(Return(true));
-    ON_CALL(*mock_player, get_weapon)
-        .WillByDefault(Throw(WeaponNotEquippedException()));
+    ON_CALL(*mock_player, find_weapon)
+        .WillByDefault(Return(nullptr));
 
     ON_CALL(*mock_weapon, is_available_for)
         .WillByDefault(Return(true));
@@ -328,8 +338,8 @@ TEST(GamePlayTest, BuyWeaponNoMoneyAssertions) {
 
     game_play.add_player(mock_player);
 
-    EXPECT_CALL(*mock_player, subtract_money(1000))
-        .WillRepeatedly(Throw(NotEnoughMoneyException()));
+    EXPECT_CALL(*mock_player, try_subtract_money(1000))
+        .WillOnce(Return(false));
 
     EXPECT_THROW(game_play.buy_weapon("", mock_weapon), NotEnoughMoneyException);
 }
@@ -342,12 +352,12 @@ TEST(GamePlayTest, AttackOccurredPlayerAssertions) {
     auto weapon = Data::get_weapon_by_name("Glock-18");
 
     ON_CALL(*mock_attacker, get_name)
-        .WillByDefault(Return("Attacker"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacker")));
     ON_CALL(*mock_attacker, get_side)
         .WillByDefault(Return(TERRORIST));
 
     ON_CALL(*mock_attacked, get_name)
-        .WillByDefault(Return("Attacked"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacked")));
     ON_CALL(*mock_attacked, get_side)
         .WillByDefault(Return(COUNTER_TERRORIST));
 
@@ -356,9 +366,9 @@ TEST(GamePlayTest, AttackOccurredPlayerAssertions) {
 
     EXPECT_CALL(*mock_attacker, is_alive)
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_attacker, get_weapon(weapon->get_type()))
+    EXPECT_CALL(*mock_attacker, find_weapon(weapon->get_type()))
         .Times(2)
-        .WillRepeatedly(Return(weapon));
+        .WillRepeatedly(Return(weapon.get()));
 
     EXPECT_CALL(*mock_attacked, is_alive)
         .Times(2)
@@ -377,12 +387,12 @@ TEST(GamePlayTest, AttackOccurredPlayerDiesAssertions) {
     auto weapon = Data::get_weapon_by_name("Glock-18");
 
     ON_CALL(*mock_attacker, get_name)
-        .WillByDefault(Return("Attacker"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacker")));
     ON_CALL(*mock_attacker, get_side)
         .WillByDefault(Return(TERRORIST));
 
     ON_CALL(*mock_attacked, get_name)
-        .WillByDefault(Return("Attacked"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacked")));
     ON_CALL(*mock_attacked, get_side)
         .WillByDefault(Return(COUNTER_TERRORIST));
 
@@ -391,9 +401,9 @@ TEST(GamePlayTest, AttackOccurredPlayerDiesAssertions) {
 
     EXPECT_CALL(*mock_attacker, is_alive)
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_attacker, get_weapon(weapon->get_type()))
+    EXPECT_CALL(*mock_attacker, find_weapon(weapon->get_type()))
         .Times(2)
-        .WillRepeatedly(Return(weapon));
+        .WillRepeatedly(Return(weapon.get()));
     EXPECT_CALL(*mock_attacker, add_kill)
         .Times(1);
     EXPECT_CALL(*mock_attacker, add_money(weapon->get_money_per_kill()))
@@ -404,10 +414,10 @@ TEST(GamePlayTest, AttackOccurredPlayerDiesAssertions) {
         .WillOnce(Return(false));
     EXPECT_CALL(*mock_attacked, take_damage(weapon->get_damage_per_hit()))
         .Times(1);
-    EXPECT_CALL(*mock_attacked, drop_weapon(PISTOL))
-        .Times(1);
-    EXPECT_CALL(*mock_attacked, drop_weapon(HEAVY))
-        .Times(1);
+    EXPECT_CALL(*mock_attacked, try_drop_weapon(PISTOL))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mock_attacked, try_drop_weapon(HEAVY))
+        .WillOnce(Return(false));
 
     game_play.attack_occurred("Attacker", "Attacked", weapon->get_type());
 }
@@ -423,7 +433,7 @@ TEST(GamePlayTest, AttackOccurredNonExistingAttackedAssertions) {
     auto mock_attacker = make_shared<MockPlayer>();
 
     ON_CALL(*mock_attacker, get_name)
-        .WillByDefault(Return("Attacker"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacker")));
     ON_CALL(*mock_attacker, get_side)
         .WillByDefault(Return(TERRORIST));
 
@@ -438,14 +448,14 @@ TEST(GamePlayTest, AttackOccurredDeadAttackerAssertions) {
     auto mock_attacked = make_shared<MockPlayer>();
 
     ON_CALL(*mock_attacker, get_name)
-        .WillByDefault(Return("Attacker"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacker")));
     ON_CALL(*mock_attacker, get_side)
         .WillByDefault(Return(TERRORIST));
     ON_CALL(*mock_attacker, is_alive)
         .WillByDefault(Return(false));
 
     ON_CALL(*mock_attacked, get_name)
-        .WillByDefault(Return("Attacked"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacked")));
     ON_CALL(*mock_attacked, get_side)
         .WillByDefault(Return(COUNTER_TERRORIST));
 
@@ -461,14 +471,14 @@ TEST(GamePlayTest, AttackOccurredDeadAttackedAssertions) {
     auto mock_attacked = make_shared<MockPlayer>();
 
     ON_CALL(*mock_attacker, get_name)
-        .WillByDefault(Return("Attacker"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacker")));
     ON_CALL(*mock_attacker, get_side)
         .WillByDefault(Return(TERRORIST));
     ON_CALL(*mock_attacker, is_alive)
         .WillByDefault(Return(true));
 
     ON_CALL(*mock_attacked, get_name)
-        .WillByDefault(Return("Attacked"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacked")));
     ON_CALL(*mock_attacked, get_side)
         .WillByDefault(Return(COUNTER_TERRORIST));
     ON_CALL(*mock_attacked, is_alive)
@@ -486,17 +496,17 @@ TEST(GamePlayTest, AttackOccurredWeaponNotEquippedAssertions) {
     auto mock_attacked = make_shared<MockPlayer>();
 
     ON_CALL(*mock_attacker, get_name)
-        .WillByDefault(Return("Attacker"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacker")));
     ON_CALL(*mock_attacker, get_side)
         .WillByDefault(Return(TERRORIST));
 
     ON_CALL(*mock_attacker, is_alive)
         .WillByDefault(Return(true));
-    ON_CALL(*mock_attacker, get_weapon)
-        .WillByDefault(Throw(WeaponNotEquippedException()));
+    ON_CALL(*mock_attacker, find_weapon)
+        .WillByDefault(Return(nullptr));
 
     ON_CALL(*mock_attacked, get_name)
-        .WillByDefault(Return("Attacked"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacked")));
     ON_CALL(*mock_attacked, get_side)
         .WillByDefault(Return(COUNTER_TERRORIST));
     ON_CALL(*mock_attacked, is_alive)
@@ -516,16 +526,16 @@ TEST(GamePlayTest, AttackOccurredFriendlyFireAssertions) {
     auto weapon = Data::get_weapon_by_name("Glock-18");
 
     ON_CALL(*mock_attacker, get_name)
-        .WillByDefault(Return("Attacker"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacker")));
     ON_CALL(*mock_attacker, get_side)
         .WillByDefault(Return(TERRORIST));
     ON_CALL(*mock_attacker, is_alive)
         .WillByDefault(Return(true));
-    ON_CALL(*mock_attacker, get_weapon(weapon->get_type()))
-        .WillByDefault(Return(weapon));
+    ON_CALL(*mock_attacker, find_weapon(weapon->get_type()))
+        .WillByDefault(Return(weapon.get()));
 
     ON_CALL(*mock_attacked, get_name)
-        .WillByDefault(Return("Attacked"));
+        .WillByDefault(ReturnRefOfCopy(string("Attacked")));
     ON_CALL(*mock_attacked, get_side)
         .WillByDefault(Return(TERRORIST));
     ON_CALL(*mock_attacked, is_alive)
@@ -537,6 +547,99 @@ TEST(GamePlayTest, AttackOccurredFriendlyFireAssertions) {
     EXPECT_THROW(game_play.attack_occurred("Attacker", "Attacked", weapon->get_type()), FriendlyFireException);
 }
 
+TEST(GamePlayTest, TryBuyWeaponResultAssertions) {
+    Data::load();
+    GamePlay game_play(10);
+    auto terrorist = game_play.create_player("Terrorist", TERRORIST);
+
+    game_play.add_player(terrorist);
+
+    EXPECT_EQ(game_play.try_buy_weapon("Nobody", Data::get_weapon_by_name("AK")), PLAYER_NOT_FOUND);
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", nullptr), WEAPON_NOT_FOUND);
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", Data::get_weapon_by_name("M4A1")), WEAPON_NOT_AVAILABLE);
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", Data::get_weapon_by_name("AK")), NOT_ENOUGH_MONEY);
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", Data::get_weapon_by_name("Glock-18")), SUCCESS);
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", Data::get_weapon_by_name("Revolver")), WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED);
+    EXPECT_EQ(terrorist->get_money(), 700);
+
+    game_play.set_round_time(45 * 1000);
+
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", Data::get_weapon_by_name("AWP")), ACTION_AT_ILLEGAL_TIME);
+}
+
+TEST(GamePlayTest, TryAttackOccurredResultAssertions) {
+    Data::load();
+    GamePlay game_play(10);
+    auto terrorist1 = game_play.create_player("Terrorist1", TERRORIST);
+    auto terrorist2 = game_play.create_player("Terrorist2", TERRORIST);
+    auto counter_terrorist = game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST);
+
+    game_play.add_player(terrorist1);
+    game_play.add_player(terrorist2);
+    game_play.add_player(counter_terrorist);
+
+    EXPECT_EQ(game_play.try_attack_occurred("Terrorist1", "Nobody", MELEE), PLAYER_NOT_FOUND);
+    EXPECT_EQ(game_play.try_attack_occurred("Terrorist1", "Terrorist2", MELEE), FRIENDLY_FIRE);
+    EXPECT_EQ(game_play.try_attack_occurred("Terrorist1", "Counter-Terrorist", PISTOL), WEAPON_NOT_EQUIPPED);
+    EXPECT_EQ(game_play.try_attack_occurred("Terrorist1", "Counter-Terrorist", MELEE), SUCCESS);
+    EXPECT_EQ(game_play.try_attack_occurred("Terrorist1", "Counter-Terrorist", MELEE), SUCCESS);
+    EXPECT_EQ(game_play.try_attack_occurred("Terrorist1", "Counter-Terrorist", MELEE), SUCCESS);
+    EXPECT_EQ(game_play.try_attack_occurred("Terrorist1", "Counter-Terrorist", MELEE), ATTACK_DEAD_PLAYER);
+    EXPECT_EQ(game_play.try_attack_occurred("Counter-Terrorist", "Terrorist1", MELEE), ACTION_FROM_DEAD_PLAYER);
+    EXPECT_EQ(terrorist1->get_kills(), 1);
+    EXPECT_EQ(counter_terrorist->get_deaths(), 1);
+}
+
+TEST(GamePlayTest, TryAttacksOccurredResultAssertions) {
+    Data::load();
+    GamePlay game_play(10);
+    PlayerHandle terrorist1 = game_play.add_player(game_play.create_player("Terrorist1", TERRORIST));
+    PlayerHandle terrorist2 = game_play.add_player(game_play.create_player("Terrorist2", TERRORIST));
+    PlayerHandle counter_terrorist = game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+    AttackEvent events[] = {
+        {terrorist1, NO_PLAYER, MELEE},
+        {terrorist1, terrorist2, MELEE},
+        {terrorist1, counter_terrorist, PISTOL},
+        {terrorist1, counter_terrorist, MELEE},
+        {terrorist1, counter_terrorist, MELEE},
+        {terrorist2, counter_terrorist, MELEE},
+        {terrorist1, counter_terrorist, MELEE},
+        {terrorist2, counter_terrorist, MELEE},
+        {counter_terrorist, terrorist1, MELEE},
+    };
+    ActionResult results[size(events)];
+
+    game_play.try_attacks_occurred(events, size(events), results);
+
+    EXPECT_THAT(results, ElementsAreArray({PLAYER_NOT_FOUND, FRIENDLY_FIRE, WEAPON_NOT_EQUIPPED, SUCCESS, SUCCESS,
+                                           SUCCESS, ATTACK_DEAD_PLAYER, ATTACK_DEAD_PLAYER, ACTION_FROM_DEAD_PLAYER}));
+    EXPECT_EQ(game_play.get_scoreboard(TERRORIST)[0]->get_name(), "Terrorist2");
+    EXPECT_EQ(game_play.get_scoreboard(TERRORIST)[0]->get_kills(), 1);
+    EXPECT_EQ(game_play.get_scoreboard(TERRORIST)[1]->get_kills(), 0);
+    EXPECT_EQ(game_play.get_money(terrorist2), 1500);
+    EXPECT_EQ(game_play.get_hp(counter_terrorist), 0);
+}
+
+TEST(GamePlayTest, TryAttacksOccurredDropsWeaponsAssertions) {
+    Data::load();
+    GamePlay game_play(10);
+    PlayerHandle terrorist = game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+    PlayerHandle counter_terrorist = game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+    game_play.buy_weapon(counter_terrorist, Data::get_weapon_by_name("Desert-Eagle"));
+    game_play.buy_weapon(terrorist, Data::get_weapon_by_name("Revolver"));
+    vector<AttackEvent> events(3, AttackEvent {terrorist, counter_terrorist, PISTOL});
+    events.push_back({counter_terrorist, terrorist, PISTOL});
+    vector<ActionResult> results(events.size());
+
+    game_play.try_attacks_occurred(events.data(), events.size(), results.data());
+
+    EXPECT_THAT(results, ElementsAreArray({SUCCESS, SUCCESS, ATTACK_DEAD_PLAYER, ACTION_FROM_DEAD_PLAYER}));
+    EXPECT_EQ(game_play.try_attack_occurred(terrorist, counter_terrorist, PISTOL), ATTACK_DEAD_PLAYER);
+    game_play.determine_winner_and_go_next_round();
+    EXPECT_EQ(game_play.try_attack_occurred(counter_terrorist, terrorist, PISTOL), WEAPON_NOT_EQUIPPED);
+    EXPECT_EQ(game_play.try_attack_occurred(terrorist, counter_terrorist, PISTOL), SUCCESS);
+}
+
 TEST(GamePlayTest, DetermineWinnerAssertions) {
     auto mock_game = make_shared<MockGame>();
     GamePlay game_play(mock_game);
@@ -586,32 +689,270 @@ TEST(GamePlayTest, GoNextRoundLastRoundAssertions) {
 TEST(GamePlayTest, GoNextRoundHandlePlayersAssertions) {
     auto mock_game = make_shared<MockGame>();
     GamePlay game_play(mock_game);
-    auto mock_winner = make_shared<MockPlayer>();
-    auto mock_loser = make_shared<MockPlayer>();
-
-    auto winners = vector<shared_ptr<Player>> {mock_winner};
-    auto losers = vector<shared_ptr<Player>> {mock_loser};
 
     ON_CALL(*mock_game, get_alive_player_count(TERRORIST))
         .WillByDefault(Return(1));
     ON_CALL(*mock_game, get_alive_player_count(COUNTER_TERRORIST))
         .WillByDefault(Return(0));
-    ON_CALL(*mock_game, get_all_players(TERRORIST))
-        .WillByDefault(Return(winners));
-    ON_CALL(*mock_game, get_all_players(COUNTER_TERRORIST))
-        .WillByDefault(Return(losers));
 
-    EXPECT_CALL(*mock_winner, reset_hp)
+    EXPECT_CALL(*mock_game, reset_players_and_add_money(TERRORIST, 2700))
         .Times(1);
-    EXPECT_CALL(*mock_winner, add_money(2700))
+    EXPECT_CALL(*mock_game, reset_players_and_add_money(COUNTER_TERRORIST, 2400))
         .Times(1);
 
-    EXPECT_CALL(*mock_loser, reset_hp)
-        .Times(1);
-    EXPECT_CALL(*mock_loser, add_money(2400))
-        .Times(1);
+    game_play.determine_winner_and_go_next_round();
+}
+
+TEST(GamePlayTest, DensePlayerStorageAssertions) {
+    Data::load();
+    GamePlay game_play(10, DENSE_PLAYER_ARRAYS);
+    auto terrorist = game_play.create_player("Terrorist", TERRORIST);
+    auto counter_terrorist = game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST);
+
+    game_play.add_player(terrorist);
+    game_play.add_player(counter_terrorist);
 
+    game_play.attack_occurred("Terrorist", "Counter-Terrorist", MELEE);
+    game_play.attack_occurred("Terrorist", "Counter-Terrorist", MELEE);
+    game_play.attack_occurred("Terrorist", "Counter-Terrorist", MELEE);
+
+    EXPECT_EQ(game_play.get_hp("Counter-Terrorist"), 0);
+    EXPECT_EQ(game_play.get_money("Terrorist"), 1500);
+    EXPECT_EQ(game_play.determine_winner_and_go_next_round(), TERRORIST);
+    EXPECT_EQ(game_play.get_hp("Counter-Terrorist"), 100);
+    EXPECT_EQ(game_play.get_money("Terrorist"), 4200);
+    EXPECT_EQ(game_play.get_money("Counter-Terrorist"), 3400);
+    EXPECT_EQ(terrorist->get_kills(), 1);
+    EXPECT_EQ(counter_terrorist->get_deaths(), 1);
+}
+
+TEST(GamePlayTest, PlayerHandleAssertions) {
+    Data::load();
+    GamePlay game_play(10);
+
+    PlayerHandle terrorist = game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+    PlayerHandle counter_terrorist = game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+
+    EXPECT_EQ(game_play.get_player_handle("Terrorist"), terrorist);
+    EXPECT_EQ(game_play.try_buy_weapon(terrorist, Data::get_weapon_by_name("Revolver")), SUCCESS);
+    EXPECT_EQ(game_play.get_money(terrorist), 400);
+    EXPECT_EQ(game_play.try_buy_weapon(terrorist, Data::get_weapon_by_name("Glock-18")), WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED);
+    EXPECT_EQ(game_play.try_attack_occurred(counter_terrorist, counter_terrorist, MELEE), FRIENDLY_FIRE);
+    EXPECT_EQ(game_play.try_attack_occurred(terrorist, 7, MELEE), PLAYER_NOT_FOUND);
+    EXPECT_EQ(game_play.try_buy_weapon(7, Data::get_weapon_by_name("AWP")), PLAYER_NOT_FOUND);
+    EXPECT_THROW(game_play.get_hp(7), PlayerNotFoundException);
+
+    game_play.attack_occurred(terrorist, counter_terrorist, PISTOL);
+    game_play.attack_occurred(terrorist, counter_terrorist, PISTOL);
+
+    EXPECT_EQ(game_play.get_hp(counter_terrorist), 0);
+    EXPECT_EQ(game_play.get_money(terrorist), 550);
+    EXPECT_THROW(game_play.buy_weapon(counter_terrorist, Data::get_weapon_by_name("AWP")), ActionFromDeadPlayerException);
+}
+
+TEST(GamePlayTest, SnapshotRoundTripAssertions) {
+    Data::load();
+    GamePlay game_play(30, DENSE_PLAYER_ARRAYS);
+
+    PlayerHandle terrorist = game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+    PlayerHandle counter_terrorist = game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+    game_play.buy_weapon(terrorist, Data::get_weapon_by_name("Revolver"));
+    game_play.attack_occurred(terrorist, counter_terrorist, PISTOL);
+    game_play.attack_occurred(terrorist, counter_terrorist, PISTOL);
+    game_play.determine_winner_and_go_next_round();
+
+    string snapshot;
+    game_play.take_snapshot(snapshot);
+
+    GamePlay restored(1);
+    restored.restore_snapshot(snapshot);
+
+    for (auto* play : {&game_play, &restored}) {
+        play->set_round_time(5000);
+        play->attack_occurred(counter_terrorist, terrorist, MELEE);
+        play->buy_weapon(counter_terrorist, Data::get_weapon_by_name("M4A1"));
+    }
+
+    for (auto player : {terrorist, counter_terrorist}) {
+        EXPECT_EQ(restored.get_hp(player), game_play.get_hp(player));
+        EXPECT_EQ(restored.get_money(player), game_play.get_money(player));
+    }
+    EXPECT_EQ(restored.get_scoreboard_view(TERRORIST)[0]->get_kills(), 1);
+    EXPECT_EQ(restored.try_buy_weapon(terrorist, Data::get_weapon_by_name("Glock-18")), WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED);
+    EXPECT_EQ(restored.determine_winner_and_go_next_round(), game_play.determine_winner_and_go_next_round());
+
+    string restored_snapshot;
+    restored.take_snapshot(restored_snapshot);
+    game_play.take_snapshot(snapshot);
+    EXPECT_EQ(restored_snapshot, snapshot);
+}
+
+TEST(GamePlayTest, CatalogPinnedByGameAssertions) {
+    auto path = get_temporary_path("csxd_pinned_weapons.json").string();
+    ofstream(path) << R"([{"name": "Knife", "price": 0, "damage_per_hit": 50, "money_per_kill": 500, )"
+                      R"("type": "knife", "available_for": "all"}])";
+
+    Data::load();
+    weak_ptr<const WeaponCatalog> first_catalog = Data::get_catalog();
+    auto game = make_shared<Game>(1, 30, 100000, 5);
+    shared_ptr<Player> terrorist;
+    {
+        GamePlay game_play(game);
+        terrorist = game_play.create_player("Terrorist", TERRORIST);
+        game_play.add_player(terrorist);
+        game_play.buy_weapon("Terrorist", game_play.get_weapon_by_name("Revolver"));
+    }
+    Data::load(path);
+    Data::load(path);
+
+    ASSERT_FALSE(first_catalog.expired());
+    EXPECT_EQ(game->get_pinned_catalog(), first_catalog.lock());
+    EXPECT_EQ(terrorist->find_weapon(PISTOL), game->get_pinned_catalog()->find("Revolver").get());
+
+    {
+        GamePlay game_play(game);
+        EXPECT_EQ(game_play.get_catalog_version(), first_catalog.lock()->get_version());
+        game_play.determine_winner_and_go_next_round();
+        EXPECT_EQ(game->get_pinned_catalog(), Data::get_catalog());
+        EXPECT_EQ(terrorist->find_weapon(MELEE), Data::get_catalog()->find("Knife").get());
+        EXPECT_EQ(terrorist->find_weapon(PISTOL), nullptr);
+    }
+    EXPECT_TRUE(first_catalog.expired());
+
+    Data::load();
+    filesystem::remove(path);
+}
+
+TEST(GamePlayTest, CatalogReloadAssertions) {
+    auto path = get_temporary_path("csxd_reloaded_weapons.json").string();
+    ofstream(path) << R"([{"name": "Knife", "price": 0, "damage_per_hit": 50, "money_per_kill": 500, )"
+                      R"("type": "knife", "available_for": "all"}, )"
+                      R"({"name": "Zeus", "price": 200, "damage_per_hit": 100, "money_per_kill": 0, )"
+                      R"("type": "pistol", "available_for": "all"}])";
+
+    Data::load();
+    GamePlay game_play(30, DENSE_PLAYER_ARRAYS);
+    PlayerHandle terrorist = game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+    PlayerHandle counter_terrorist = game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+    game_play.buy_weapon(terrorist, game_play.get_weapon_by_name("Revolver"));
+
+    auto pinned_catalog = Data::get_catalog();
+    ull pinned_version = game_play.get_catalog_version();
+    EXPECT_EQ(pinned_version, Data::get_catalog_version());
+    Data::load(path);
+    EXPECT_EQ(Data::get_catalog_version(), pinned_version + 1);
+    EXPECT_EQ(pinned_catalog->get_version(), pinned_version);
+    EXPECT_NE(pinned_catalog->find("Revolver"), nullptr);
+    EXPECT_EQ(pinned_catalog->find("Zeus"), nullptr);
+
+    EXPECT_EQ(game_play.get_catalog_version(), pinned_version);
+    EXPECT_EQ(game_play.try_get_weapon_by_name("Zeus"), nullptr);
+    game_play.attack_occurred(terrorist, counter_terrorist, PISTOL);
+    EXPECT_EQ(game_play.get_hp(counter_terrorist), 100 - pinned_catalog->find("Revolver")->get_damage_per_hit());
+
+    game_play.determine_winner_and_go_next_round();
+    EXPECT_EQ(game_play.get_catalog_version(), pinned_version + 1);
+    EXPECT_EQ(game_play.try_get_weapon_by_name("Revolver"), nullptr);
+    EXPECT_EQ(game_play.try_attack_occurred(terrorist, counter_terrorist, PISTOL), WEAPON_NOT_EQUIPPED);
+    game_play.attack_occurred(terrorist, counter_terrorist, MELEE);
+    EXPECT_EQ(game_play.get_hp(counter_terrorist), 50);
+    game_play.buy_weapon(terrorist, game_play.get_weapon_by_name("Zeus"));
+
+    Data::load();
     game_play.determine_winner_and_go_next_round();
+    EXPECT_EQ(game_play.get_catalog_version(), pinned_version + 2);
+    EXPECT_EQ(game_play.try_attack_occurred(terrorist, counter_terrorist, PISTOL), WEAPON_NOT_EQUIPPED);
+    EXPECT_EQ(game_play.try_buy_weapon(terrorist, game_play.get_weapon_by_name("Revolver")), SUCCESS);
+
+    filesystem::remove(path);
+}
+
+namespace {
+
+class CountingMemoryResource : public pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+
+    bool owns(const void* pointer) const {
+        for (const auto& [block, bytes] : blocks) {
+            if (pointer >= block && pointer < static_cast<const char*>(block) + bytes) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocations++;
+        void* pointer = pmr::new_delete_resource()->allocate(bytes, alignment);
+        blocks[pointer] = bytes;
+        return pointer;
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+        deallocations++;
+        blocks.erase(pointer);
+        pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    map<const void*, size_t> blocks;
+};
+
+}
+
+TEST(GamePlayTest, MemoryResourceAssertions) {
+    Data::load();
+    CountingMemoryResource memory;
+    auto default_memory = pmr::set_default_resource(pmr::null_memory_resource());
+    {
+        GamePlay game_play(30, DENSE_PLAYER_ARRAYS, &memory);
+        PlayerHandle terrorist = game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+        PlayerHandle counter_terrorist = game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+        size_t allocations = memory.allocations;
+        EXPECT_GT(allocations, 0);
+
+        game_play.attack_occurred(terrorist, counter_terrorist, MELEE);
+        game_play.determine_winner_and_go_next_round();
+        EXPECT_EQ(memory.allocations, allocations);
+
+        string snapshot;
+        game_play.take_snapshot(snapshot);
+        game_play.restore_snapshot(snapshot);
+        EXPECT_GT(memory.allocations, allocations);
+        EXPECT_EQ(game_play.get_hp(counter_terrorist), 100);
+    }
+    pmr::set_default_resource(default_memory);
+
+    EXPECT_EQ(memory.deallocations, memory.allocations);
+}
+
+TEST(GamePlayTest, RecoverMemoryResourceAssertions) {
+    Data::load();
+    for (uint rounds_per_snapshot : {0u, 1u}) {
+        ostringstream journal_stream;
+        {
+            EventJournal journal(journal_stream);
+            GamePlay game_play(3);
+            game_play.set_journal(&journal, rounds_per_snapshot);
+            game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+            game_play.add_player(game_play.create_player("Counter-Terrorist", COUNTER_TERRORIST));
+            game_play.determine_winner_and_go_next_round();
+        }
+
+        CountingMemoryResource memory;
+        GamePlay game_play(3, PLAYER_OBJECTS, &memory);
+        game_play.recover(journal_stream.str());
+        for (Side side : {COUNTER_TERRORIST, TERRORIST}) {
+            ASSERT_EQ(game_play.get_scoreboard_view(side).size(), 1);
+            EXPECT_TRUE(memory.owns(game_play.get_scoreboard_view(side)[0].get()));
+        }
+    }
 }
 
 TEST(GamePlayTest, ScoreboardAssertions) {
@@ -664,6 +1005,18 @@ TEST(GamePlayTest, ScoreboardAssertions) {
     EXPECT_THAT(game_play.get_scoreboard(ALL), ElementsAreArray(players_in_correct_order));
 }
 
+TEST(GamePlayTest, ScoreboardViewAssertions) {
+    auto mock_game = make_shared<MockGame>();
+    GamePlay game_play(mock_game);
+    auto mock_player = make_shared<MockPlayer>();
+    pmr::vector<shared_ptr<Player>> scoreboard {mock_player};
+
+    EXPECT_CALL(*mock_game, get_scoreboard(TERRORIST))
+        .WillOnce(ReturnRef(scoreboard));
+
+    EXPECT_EQ(&game_play.get_scoreboard_view(TERRORIST), &scoreboard);
+}
+
 TEST(GamePlayTest, HasEndedAssertions) {
     auto mock_game = make_shared<MockGame>();
     GamePlay game_play(mock_game);
@@ -2,6 +2,7 @@
 #include "gmock/gmock.h"
 
 #include "models/game/Game.h"
+#include "utils/data/Data.h"
 #include "exceptions/LastRoundException.h"
 #include "exceptions/NullPointerException.h"
 #include "exceptions/PlayerAlreadyInTeamException.h"
@@ -10,6 +11,7 @@
 #include "exceptions/TeamIsFullException.h"
 
 using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
 using ::testing::UnorderedElementsAre;
 using ::testing::UnorderedElementsAreArray;
 
@@ -139,6 +141,36 @@ TEST(GameTest, NotAddedPlayerAssertions) {
     EXPECT_THROW(game.get_player_by_name("Terrorist"), PlayerNotFoundException);
 }
 
+TEST(GameTest, FindPlayerAssertions) {
+    Game game(1, 13, 180 * 1000, 10);
+
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 100, 10000, 1000, TERRORIST, 1);
+
+    game.add_player(terrorist_player);
+
+    EXPECT_EQ(game.find_player_by_name("Terrorist"), terrorist_player);
+    EXPECT_EQ(game.find_player_by_name("Counter-Terrorist"), nullptr);
+}
+
+TEST(GameTest, PlayerHandleAssertions) {
+    Game game(1, 13, 180 * 1000, 10);
+
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 100, 10000, 1000, TERRORIST, 1);
+    shared_ptr<Player> counter_terrorist_player = make_shared<Player>("Counter-Terrorist", 100, 10000, 1000, COUNTER_TERRORIST, 2);
+
+    PlayerHandle terrorist_handle = game.add_player(terrorist_player);
+    PlayerHandle counter_terrorist_handle = game.add_player(counter_terrorist_player);
+
+    EXPECT_NE(terrorist_handle, counter_terrorist_handle);
+    EXPECT_EQ(game.get_player_handle("Terrorist"), terrorist_handle);
+    EXPECT_EQ(game.get_player_handle("Counter-Terrorist"), counter_terrorist_handle);
+    EXPECT_EQ(game.get_player_by_handle(terrorist_handle), terrorist_player);
+    EXPECT_EQ(game.find_player_by_handle(counter_terrorist_handle), counter_terrorist_player);
+    EXPECT_EQ(game.find_player_by_handle(2), nullptr);
+    EXPECT_THROW(game.get_player_by_handle(2), PlayerNotFoundException);
+    EXPECT_THROW(game.get_player_handle("Player"), PlayerNotFoundException);
+}
+
 TEST(GameTest, AddPlayerToFullTeamAssertions) {
     Game game(1, 13, 180 * 1000, 2);
 
@@ -232,4 +264,356 @@ TEST(GameTest, GetAlivePlayerCountAssertions) {
     EXPECT_EQ(game.get_alive_player_count(ALL), 2);
     EXPECT_EQ(game.get_alive_player_count(TERRORIST), 1);
     EXPECT_EQ(game.get_alive_player_count(COUNTER_TERRORIST), 1);
-}
\ No newline at end of file
+}
+
+TEST(GameTest, ResetPlayersAndAddMoneyAssertions) {
+    Game game(1, 13, 180 * 1000, 10);
+
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 0, 10000, 9000, TERRORIST, 1);
+    shared_ptr<Player> counter_terrorist_player = make_shared<Player>("Counter-Terrorist", 30, 10000, 1000, COUNTER_TERRORIST, 2);
+
+    game.add_player(terrorist_player);
+    game.add_player(counter_terrorist_player);
+
+    game.reset_players_and_add_money(TERRORIST, 2700);
+
+    EXPECT_EQ(terrorist_player->get_hp(), 100);
+    EXPECT_EQ(terrorist_player->get_money(), 10000);
+    EXPECT_EQ(counter_terrorist_player->get_hp(), 30);
+    EXPECT_EQ(counter_terrorist_player->get_money(), 1000);
+}
+
+TEST(GameTest, DensePlayerStorageAssertions) {
+    Game game(1, 13, 180 * 1000, 10, DENSE_PLAYER_ARRAYS);
+
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 100, 10000, 9000, TERRORIST, 1);
+    shared_ptr<Player> counter_terrorist_player1 = make_shared<Player>("Counter-Terrorist1", 100, 10000, 1000, COUNTER_TERRORIST, 2);
+    shared_ptr<Player> counter_terrorist_player2 = make_shared<Player>("Counter-Terrorist2", 0, 10000, 1000, COUNTER_TERRORIST, 2);
+
+    game.add_player(terrorist_player);
+    game.add_player(counter_terrorist_player1);
+    game.add_player(counter_terrorist_player2);
+
+    EXPECT_EQ(game.get_player_storage(), DENSE_PLAYER_ARRAYS);
+    EXPECT_EQ(game.get_alive_player_count(COUNTER_TERRORIST), 1);
+    EXPECT_EQ(game.get_alive_player_count(ALL), 2);
+
+    counter_terrorist_player1->take_damage(100);
+    terrorist_player->add_kill();
+
+    EXPECT_EQ(game.get_alive_player_count(COUNTER_TERRORIST), 0);
+    EXPECT_EQ(counter_terrorist_player1->get_deaths(), 1);
+    EXPECT_EQ(terrorist_player->get_kills(), 1);
+
+    game.reset_players_and_add_money(COUNTER_TERRORIST, 2400);
+
+    EXPECT_EQ(game.get_alive_player_count(COUNTER_TERRORIST), 2);
+    EXPECT_EQ(counter_terrorist_player1->get_hp(), 100);
+    EXPECT_EQ(counter_terrorist_player1->get_money(), 3400);
+    EXPECT_EQ(terrorist_player->get_money(), 9000);
+}
+
+TEST(GameTest, DensePlayerStorageOutlivesGameAssertions) {
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 100, 10000, 1000, TERRORIST, 1);
+    {
+        Game game(1, 13, 180 * 1000, 10, DENSE_PLAYER_ARRAYS);
+        game.add_player(terrorist_player);
+        terrorist_player->take_damage(30);
+        terrorist_player->add_money(500);
+    }
+
+    EXPECT_EQ(terrorist_player->get_hp(), 70);
+    EXPECT_EQ(terrorist_player->get_money(), 1500);
+}
+
+TEST(GameTest, GetTeamAssertions) {
+    Game game(1, 13, 180 * 1000, 10);
+
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 100, 10000, 1000, TERRORIST, 1);
+    shared_ptr<Player> counter_terrorist_player = make_shared<Player>("Counter-Terrorist", 100, 10000, 1000, COUNTER_TERRORIST, 2);
+
+    game.add_player(terrorist_player);
+    game.add_player(counter_terrorist_player);
+
+    EXPECT_THAT(game.get_team(TERRORIST), ElementsAre(terrorist_player));
+    EXPECT_THAT(game.get_team(COUNTER_TERRORIST), ElementsAre(counter_terrorist_player));
+    EXPECT_THROW(game.get_team(ALL), invalid_argument);
+}
+
+TEST(GameTest, AlivePlayerCountAfterReviveAssertions) {
+    Game game(1, 13, 180 * 1000, 10);
+
+    shared_ptr<Player> late_player = make_shared<Player>("Late", 0, 10000, 1000, TERRORIST, 1);
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 100, 10000, 1000, TERRORIST, 1);
+
+    game.add_player(late_player);
+    game.add_player(terrorist_player);
+
+    EXPECT_EQ(game.get_alive_player_count(TERRORIST), 1);
+
+    late_player->add_hp(10);
+    terrorist_player->take_damage(100);
+    terrorist_player->take_damage(100);
+
+    EXPECT_EQ(game.get_alive_player_count(TERRORIST), 1);
+
+    game.reset_players_and_add_money(TERRORIST, 0);
+
+    EXPECT_EQ(game.get_alive_player_count(TERRORIST), 2);
+    EXPECT_EQ(game.get_alive_player_count(COUNTER_TERRORIST), 0);
+}
+
+TEST(GameTest, AlivePlayerCountMatchesScanAssertions) {
+    for (auto storage : {PLAYER_OBJECTS, DENSE_PLAYER_ARRAYS}) {
+        Game game(1, 13, 180 * 1000, 20, storage);
+        vector<shared_ptr<Player>> players;
+        for (int i = 0; i < 40; i++) {
+            players.push_back(make_shared<Player>("P" + to_string(i), 100, 10000, 1000,
+                                                  i % 2 ? TERRORIST : COUNTER_TERRORIST, i * 100));
+            game.add_player(players.back());
+        }
+
+        uint seed = 11;
+        for (int i = 0; i < 2000; i++) {
+            seed = seed * 1103515245 + 12345;
+            auto& player = players[(seed >> 8) % players.size()];
+            if (seed & 1) {
+                player->take_damage(60);
+            }
+            else if (seed & 2) {
+                player->reset_hp();
+            }
+            else {
+                game.reset_players_and_add_money(player->get_side(), 0);
+            }
+
+            for (auto side : {TERRORIST, COUNTER_TERRORIST, ALL}) {
+                ASSERT_EQ(game.get_alive_player_count(side), game.get_alive_players(side).size());
+            }
+        }
+    }
+}
+
+TEST(GameTest, PlayerOutlivesGameAssertions) {
+    shared_ptr<Player> terrorist_player = make_shared<Player>("Terrorist", 100, 10000, 1000, TERRORIST, 1);
+    {
+        Game game(1, 13, 180 * 1000, 10);
+        game.add_player(terrorist_player);
+    }
+
+    EXPECT_NO_THROW(terrorist_player->take_damage(100));
+    EXPECT_NO_THROW(terrorist_player->reset_hp());
+}
+
+TEST(GameTest, ScoreboardAssertions) {
+    Game game(1, 13, 180 * 1000, 10);
+
+    shared_ptr<Player> first_player = make_shared<Player>("First", 100, 10000, 1000, TERRORIST, 1000);
+    shared_ptr<Player> second_player = make_shared<Player>("Second", 100, 10000, 1000, TERRORIST, 2000);
+    shared_ptr<Player> third_player = make_shared<Player>("Third", 100, 10000, 1000, TERRORIST, 3000);
+    shared_ptr<Player> counter_terrorist_player = make_shared<Player>("Counter-Terrorist", 100, 10000, 1000, COUNTER_TERRORIST, 500);
+
+    game.add_player(third_player);
+    game.add_player(first_player);
+    game.add_player(counter_terrorist_player);
+    game.add_player(second_player);
+
+    EXPECT_THAT(game.get_scoreboard(TERRORIST), ElementsAre(first_player, second_player, third_player));
+    EXPECT_THAT(game.get_scoreboard(COUNTER_TERRORIST), ElementsAre(counter_terrorist_player));
+    EXPECT_THROW(game.get_scoreboard(ALL), invalid_argument);
+
+    third_player->add_kill();
+
+    EXPECT_THAT(game.get_scoreboard(TERRORIST), ElementsAre(third_player, first_player, second_player));
+
+    first_player->take_damage(100);
+
+    EXPECT_THAT(game.get_scoreboard(TERRORIST), ElementsAre(third_player, second_player, first_player));
+
+    second_player->add_kill();
+    second_player->take_damage(100);
+
+    EXPECT_THAT(game.get_scoreboard(TERRORIST), ElementsAre(third_player, second_player, first_player));
+
+    second_player->add_kill();
+
+    EXPECT_THAT(game.get_scoreboard(TERRORIST), ElementsAre(second_player, third_player, first_player));
+}
+
+TEST(GameTest, ScoreboardMatchesSortAssertions) {
+    for (auto storage : {PLAYER_OBJECTS, DENSE_PLAYER_ARRAYS}) {
+        Game game(1, 13, 180 * 1000, 50, storage);
+        vector<shared_ptr<Player>> players;
+        for (int i = 0; i < 50; i++) {
+            players.push_back(make_shared<Player>("T" + to_string(i), 100, 10000, 1000, TERRORIST, i * 100));
+            game.add_player(players.back());
+        }
+
+        uint seed = 7;
+        for (int i = 0; i < 2000; i++) {
+            seed = seed * 1103515245 + 12345;
+            auto& player = players[(seed >> 8) % players.size()];
+            if (seed & 1) {
+                player->add_kill();
+            }
+            else {
+                player->take_damage(100);
+                player->reset_hp();
+            }
+
+            auto sorted = players;
+            sort(sorted.begin(), sorted.end(), Scoreboard::comparer);
+            ASSERT_THAT(game.get_scoreboard(TERRORIST), ElementsAreArray(sorted));
+        }
+    }
+}
+
+namespace {
+
+void expect_same_player(const shared_ptr<Player>& restored, const shared_ptr<Player>& original) {
+    EXPECT_EQ(restored->get_name(), original->get_name());
+    EXPECT_EQ(restored->get_side(), original->get_side());
+    EXPECT_EQ(restored->get_entry_time(), original->get_entry_time());
+    EXPECT_EQ(restored->get_hp(), original->get_hp());
+    EXPECT_EQ(restored->get_max_money(), original->get_max_money());
+    EXPECT_EQ(restored->get_money(), original->get_money());
+    EXPECT_EQ(restored->get_kills(), original->get_kills());
+    EXPECT_EQ(restored->get_deaths(), original->get_deaths());
+    for (auto type : {MELEE, PISTOL, HEAVY}) {
+        EXPECT_EQ(restored->find_weapon(type), original->find_weapon(type));
+    }
+}
+
+}
+
+TEST(GameTest, SnapshotRoundTripAssertions) {
+    Data::load();
+    for (auto storage : {PLAYER_OBJECTS, DENSE_PLAYER_ARRAYS}) {
+        Game game(1, 30, 180 * 1000, 10, storage);
+        vector<shared_ptr<Player>> players;
+        for (int i = 0; i < 20; i++) {
+            Side side = i % 2 ? TERRORIST : COUNTER_TERRORIST;
+            players.push_back(make_shared<Player>("P" + to_string(i), 100, 10000, 800 + i, side, i * 100));
+            players.back()->equip_weapon(Data::get_weapon_by_name("Knife").get());
+            game.add_player(players.back());
+        }
+        players[3]->equip_weapon(Data::get_weapon_by_name("Revolver").get());
+        players[4]->equip_weapon(Data::get_weapon_by_name("M4A1").get());
+        players[4]->add_kill();
+        players[4]->add_kill();
+        players[7]->take_damage(100);
+        players[9]->take_damage(35);
+        players[9]->add_kill();
+        players[0]->try_drop_weapon(MELEE);
+        for (int i = 0; i < 27; i++) {
+            game.go_next_round();
+        }
+        game.set_round_time(12345);
+
+        string snapshot;
+        game.take_snapshot(snapshot);
+
+        Game restored(2, 1, 1, 1, storage);
+        restored.restore_snapshot(snapshot, Data::get_catalog());
+
+        EXPECT_EQ(restored.get_id(), 2);
+        EXPECT_EQ(restored.get_player_storage(), storage);
+        EXPECT_EQ(restored.get_rounds(), 30);
+        EXPECT_EQ(restored.get_current_round(), 28);
+        EXPECT_EQ(restored.get_round_length(), 180 * 1000);
+        EXPECT_EQ(restored.get_round_time(), 12345);
+        EXPECT_EQ(restored.get_game_time(), game.get_game_time());
+        EXPECT_EQ(restored.get_max_team_size(), 10);
+        EXPECT_FALSE(restored.has_ended());
+        EXPECT_EQ(restored.get_alive_player_count(TERRORIST), 9);
+        EXPECT_EQ(restored.get_alive_player_count(COUNTER_TERRORIST), 10);
+
+        for (PlayerHandle handle = 0; handle < players.size(); handle++) {
+            expect_same_player(restored.get_player_by_handle(handle), players[handle]);
+            EXPECT_EQ(restored.get_player_handle(players[handle]->get_name()), handle);
+        }
+        for (auto side : {COUNTER_TERRORIST, TERRORIST}) {
+            const auto& scoreboard = restored.get_scoreboard(side);
+            ASSERT_EQ(scoreboard.size(), game.get_scoreboard(side).size());
+            for (size_t i = 0; i < scoreboard.size(); i++) {
+                EXPECT_EQ(scoreboard[i]->get_name(), game.get_scoreboard(side)[i]->get_name());
+            }
+        }
+
+        restored.get_player_by_handle(4)->add_kill();
+        EXPECT_EQ(players[4]->get_kills(), 2);
+
+        string second_snapshot;
+        game.take_snapshot(second_snapshot);
+        EXPECT_EQ(second_snapshot, snapshot);
+    }
+}
+
+TEST(GameTest, SnapshotMalformedAssertions) {
+    Data::load();
+    Game game(1, 13, 180 * 1000, 10);
+    auto player = make_shared<Player>("Player", 100, 10000, 1000, TERRORIST, 0);
+    player->equip_weapon(Data::get_weapon_by_name("AK").get());
+    game.add_player(player);
+
+    string snapshot;
+    game.take_snapshot(snapshot);
+
+    Game restored(1, 13, 180 * 1000, 10);
+    restored.add_player(make_shared<Player>("Other", 100, 10000, 1000, TERRORIST, 0));
+
+    EXPECT_THROW(restored.restore_snapshot("XSXS", Data::get_catalog()), invalid_argument);
+    EXPECT_THROW(restored.restore_snapshot(snapshot.substr(0, snapshot.size() - 1), Data::get_catalog()), invalid_argument);
+    EXPECT_THROW(restored.restore_snapshot(snapshot + '\0', Data::get_catalog()), invalid_argument);
+
+    string unknown_weapon = snapshot;
+    unknown_weapon.replace(unknown_weapon.find("AK"), 2, "XY");
+    EXPECT_THROW(restored.restore_snapshot(unknown_weapon, Data::get_catalog()), invalid_argument);
+
+    EXPECT_NE(restored.find_player_by_name("Other"), nullptr);
+    EXPECT_EQ(restored.find_player_by_name("Player"), nullptr);
+
+    restored.restore_snapshot(snapshot, Data::get_catalog());
+
+    EXPECT_EQ(restored.find_player_by_name("Other"), nullptr);
+    EXPECT_EQ(restored.get_player_by_name("Player")->find_weapon(HEAVY), player->find_weapon(HEAVY));
+}
+
+TEST(GameTest, SnapshotDuplicatePlayerNameAssertions) {
+    Data::load();
+    Game game(1, 13, 180 * 1000, 10);
+    game.add_player(make_shared<Player>("Player1", 100, 10000, 1000, TERRORIST, 0));
+    game.add_player(make_shared<Player>("Player2", 100, 10000, 1000, COUNTER_TERRORIST, 0));
+    string snapshot;
+    game.take_snapshot(snapshot);
+    snapshot.replace(snapshot.find("Player2"), 7, "Player1");
+
+    Game restored(1, 13, 180 * 1000, 10);
+    restored.add_player(make_shared<Player>("Other", 100, 10000, 1000, TERRORIST, 0));
+
+    EXPECT_THROW(restored.restore_snapshot(snapshot, Data::get_catalog()), invalid_argument);
+    EXPECT_NE(restored.find_player_by_name("Other"), nullptr);
+    EXPECT_EQ(restored.find_player_by_name("Player1"), nullptr);
+    EXPECT_EQ(restored.get_alive_player_count(ALL), 1);
+}
+
+TEST(GameTest, SnapshotTeamLargerThanMaxTeamSizeAssertions) {
+    Data::load();
+    Game game(1, 13, 100, 2);
+    game.add_player(make_shared<Player>("Player1", 100, 10000, 1000, TERRORIST, 0));
+    game.add_player(make_shared<Player>("Player2", 100, 10000, 1000, TERRORIST, 0));
+    string snapshot;
+    game.take_snapshot(snapshot);
+    // The magic, then one-byte varints of the version, rounds and round length before the max team size
+    size_t max_team_size_position = 7;
+    ASSERT_EQ(snapshot[max_team_size_position], 2);
+    snapshot[max_team_size_position] = 1;
+
+    Game restored(1, 13, 180 * 1000, 10);
+    restored.add_player(make_shared<Player>("Other", 100, 10000, 1000, TERRORIST, 0));
+
+    EXPECT_THROW(restored.restore_snapshot(snapshot, Data::get_catalog()), invalid_argument);
+    EXPECT_NE(restored.find_player_by_name("Other"), nullptr);
+    EXPECT_EQ(restored.get_max_team_size(), 10);
+    EXPECT_EQ(restored.get_alive_player_count(ALL), 1);
+}
@@ -24,17 +24,21 @@
 #include "exceptions/WeaponOfThisTypeAlreadyEquippedException.h"
 
 using ::testing::Return;
+using ::testing::ReturnRefOfCopy;
 using ::testing::Throw;
 using ::testing::Eq;
+using ::testing::Invoke;
+using ::testing::ReturnRef;
 
 TEST(InteractionsTest, InitAssertions) {
     string input = "5";
     stringstream input_stream(input);
-    Interactions::set_input_stream(input_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
 
-    Interactions::init();
+    interactions.init();
 
-    EXPECT_EQ(Interactions::get_rounds(), 5);
+    EXPECT_EQ(interactions.get_rounds(), 5);
 }
 
 TEST(InteractionsTest, AddUserAssertions) {
@@ -42,8 +46,9 @@ TEST(InteractionsTest, AddUserAssertions) {
     string expected = "this user added to Counter-Terrorist\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
     auto mock_player = make_shared<MockPlayer>();
@@ -60,21 +65,160 @@ TEST(InteractionsTest, AddUserAssertions) {
     EXPECT_CALL(*mock_game_play, determine_winner_and_go_next_round)
         .WillOnce(Return(COUNTER_TERRORIST));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
 }
 
+TEST(InteractionsTest, InvalidCommandFlushesOutputAssertions) {
+    string input = "1\nROUND 2\nGET-HEALTH Player 00:01:000\nJUMP Player 00:02:000\n";
+    ostringstream output_stream;
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output_stream);
+
+    auto mock_game_play = make_shared<MockGamePlay>();
+
+    EXPECT_CALL(*mock_game_play, has_ended())
+        .WillOnce(Return(false));
+    EXPECT_CALL(*mock_game_play, set_round_time(1000))
+        .Times(1);
+    EXPECT_CALL(*mock_game_play, get_hp("Player"))
+        .WillOnce(Return(63));
+
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+
+    EXPECT_THROW(interactions.begin(), invalid_argument);
+    EXPECT_EQ(output_stream.str(), "63\n");
+}
+
+TEST(InteractionsTest, InvalidTimeAssertions) {
+    for (string command : {"ADD-USER Player Terrorist", "GET-HEALTH Player 00:01", "GET-MONEY Player 00:01:0000",
+                           "SCORE-BOARD 00:01;000", "TAP Player Other knife 0a:01:000"}) {
+        string input = "1\nROUND 1\n" + command + "\n";
+        ostringstream output_stream;
+        Interactions interactions;
+        interactions.set_input_buffer(input);
+        interactions.set_output_stream(output_stream);
+
+        auto mock_game_play = make_shared<MockGamePlay>();
+
+        EXPECT_CALL(*mock_game_play, has_ended())
+            .WillOnce(Return(false));
+        EXPECT_CALL(*mock_game_play, set_round_time)
+            .Times(0);
+
+        interactions.init();
+        interactions.set_game_play(mock_game_play);
+
+        EXPECT_THROW(interactions.begin(), invalid_argument);
+        EXPECT_EQ(output_stream.str(), "");
+    }
+}
+
+TEST(InteractionsTest, InputBufferAssertions) {
+    string input = "1\nROUND 1\nGET-HEALTH Player 00:01:000\n";
+    string expected = "63\nCounter-Terrorist won\n";
+    ostringstream output_stream;
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output_stream);
+
+    auto mock_game_play = make_shared<MockGamePlay>();
+
+    EXPECT_CALL(*mock_game_play, has_ended())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mock_game_play, set_round_time(1000))
+        .Times(1);
+    EXPECT_CALL(*mock_game_play, get_hp("Player"))
+        .WillOnce(Return(63));
+    EXPECT_CALL(*mock_game_play, determine_winner_and_go_next_round)
+        .WillOnce(Return(COUNTER_TERRORIST));
+
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
+
+    string output = output_stream.str();
+    EXPECT_EQ(output, expected);
+}
+
+TEST(InteractionsTest, OutputFlushedPerRoundAssertions) {
+    string input = "1\nROUND 1\nGET-HEALTH Player 00:01:000";
+    stringstream input_stream(input);
+    ostringstream output_stream;
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
+
+    auto mock_game_play = make_shared<MockGamePlay>();
+    string output_before_round_end = "not checked";
+
+    ON_CALL(*mock_game_play, get_hp)
+        .WillByDefault(Return(63));
+
+    EXPECT_CALL(*mock_game_play, has_ended())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mock_game_play, determine_winner_and_go_next_round)
+        .WillOnce(Invoke([&]() {
+            output_before_round_end = output_stream.str();
+            return COUNTER_TERRORIST;
+        }));
+
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
+
+    EXPECT_EQ(output_before_round_end, "");
+    EXPECT_EQ(output_stream.str(), "63\nCounter-Terrorist won\n");
+}
+
+TEST(InteractionsTest, OutputFlushedPerCommandAssertions) {
+    string input = "1\nROUND 1\nGET-HEALTH Player 00:01:000";
+    stringstream input_stream(input);
+    ostringstream output_stream;
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
+    interactions.set_flush_per_command(true);
+
+    auto mock_game_play = make_shared<MockGamePlay>();
+    string output_before_round_end = "not checked";
+
+    ON_CALL(*mock_game_play, get_hp)
+        .WillByDefault(Return(63));
+
+    EXPECT_CALL(*mock_game_play, has_ended())
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mock_game_play, determine_winner_and_go_next_round)
+        .WillOnce(Invoke([&]() {
+            output_before_round_end = output_stream.str();
+            return COUNTER_TERRORIST;
+        }));
+
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
+
+    EXPECT_EQ(output_before_round_end, "63\n");
+    EXPECT_EQ(output_stream.str(), "63\nCounter-Terrorist won\n");
+}
+
 TEST(InteractionsTest, AddUserAlreadyInTeamAssertions) {
     string input = "1\nROUND 1\nADD-USER Player Counter-Terrorist 00:01:000";
     string expected = "you are already in this game\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -87,9 +231,9 @@ TEST(InteractionsTest, AddUserAlreadyInTeamAssertions) {
     EXPECT_CALL(*mock_game_play, add_player)
         .WillOnce(Throw(PlayerAlreadyInTeamException()));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -100,8 +244,9 @@ TEST(InteractionsTest, AddUserInOpponentTeamAssertions) {
     string expected = "you are already in this game\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -114,9 +259,9 @@ TEST(InteractionsTest, AddUserInOpponentTeamAssertions) {
     EXPECT_CALL(*mock_game_play, add_player)
         .WillOnce(Throw(PlayerInOpponentTeamException()));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -127,8 +272,9 @@ TEST(InteractionsTest, AddUserFullTeamAssertions) {
     string expected = "this team is full\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -141,9 +287,9 @@ TEST(InteractionsTest, AddUserFullTeamAssertions) {
     EXPECT_CALL(*mock_game_play, add_player)
         .WillOnce(Throw(TeamIsFullException()));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -154,8 +300,9 @@ TEST(InteractionsTest, GetHealthAssertions) {
     string expected = "63\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -170,9 +317,9 @@ TEST(InteractionsTest, GetHealthAssertions) {
     EXPECT_CALL(*mock_game_play, get_hp("Player"))
         .WillOnce(Return(63));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -183,8 +330,9 @@ TEST(InteractionsTest, GetHealthNonExistingPlayerAssertions) {
     string expected = "invalid username\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -197,9 +345,9 @@ TEST(InteractionsTest, GetHealthNonExistingPlayerAssertions) {
     EXPECT_CALL(*mock_game_play, get_hp)
         .WillOnce(Throw(PlayerNotFoundException()));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -210,8 +358,9 @@ TEST(InteractionsTest, GetMoneyAssertions) {
     string expected = "3700\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -226,9 +375,9 @@ TEST(InteractionsTest, GetMoneyAssertions) {
     EXPECT_CALL(*mock_game_play, get_money("Player"))
         .WillOnce(Return(3700));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -239,8 +388,9 @@ TEST(InteractionsTest, GetMoneyNonExistingPlayerAssertions) {
     string expected = "invalid username\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -253,9 +403,9 @@ TEST(InteractionsTest, GetMoneyNonExistingPlayerAssertions) {
     EXPECT_CALL(*mock_game_play, get_money)
         .WillOnce(Throw(PlayerNotFoundException()));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -266,8 +416,9 @@ TEST(InteractionsTest, BuyAssertions) {
     string expected = "I hope you can use it\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
     Data::load();
 
     auto mock_game_play = make_shared<MockGamePlay>();
@@ -280,12 +431,12 @@ TEST(InteractionsTest, BuyAssertions) {
         .WillOnce(Return(true));
     EXPECT_CALL(*mock_game_play, set_round_time(1000))
         .Times(1);
-    EXPECT_CALL(*mock_game_play, buy_weapon("Player", Eq(Data::get_weapon_by_name("AWP"))))
-        .Times(1);
+    EXPECT_CALL(*mock_game_play, try_buy_weapon("Player", Eq(Data::get_weapon_by_name("AWP"))))
+        .WillOnce(Return(SUCCESS));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -296,8 +447,9 @@ TEST(InteractionsTest, BuyNonExistingPlayerAssertions) {
     string expected = "invalid username\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -307,12 +459,12 @@ TEST(InteractionsTest, BuyNonExistingPlayerAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended())
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, buy_weapon)
-        .WillOnce(Throw(PlayerNotFoundException()));
+    EXPECT_CALL(*mock_game_play, try_buy_weapon)
+        .WillOnce(Return(PLAYER_NOT_FOUND));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -323,8 +475,9 @@ TEST(InteractionsTest, BuyDeadPlayerAssertions) {
     string expected = "deads can not buy\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -334,12 +487,12 @@ TEST(InteractionsTest, BuyDeadPlayerAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended())
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, buy_weapon)
-        .WillOnce(Throw(ActionFromDeadPlayerException()));
+    EXPECT_CALL(*mock_game_play, try_buy_weapon)
+        .WillOnce(Return(ACTION_FROM_DEAD_PLAYER));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -350,8 +503,9 @@ TEST(InteractionsTest, BuyAfterTimeLimitAssertions) {
     string expected = "you are out of time\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -361,12 +515,12 @@ TEST(InteractionsTest, BuyAfterTimeLimitAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended())
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, buy_weapon)
-        .WillOnce(Throw(ActionAtIllegalTimeException()));
+    EXPECT_CALL(*mock_game_play, try_buy_weapon)
+        .WillOnce(Return(ACTION_AT_ILLEGAL_TIME));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -377,8 +531,9 @@ TEST(InteractionsTest, BuyNonExistingWeaponAssertions) {
     string expected = "invalid category gun\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -388,12 +543,12 @@ TEST(InteractionsTest, BuyNonExistingWeaponAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended())
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, buy_weapon)
-        .WillOnce(Throw(NullPointerException("weapon")));
+    EXPECT_CALL(*mock_game_play, try_buy_weapon)
+        .WillOnce(Return(WEAPON_NOT_FOUND));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -404,8 +559,9 @@ TEST(InteractionsTest, BuyWeaponNotAvailableAssertions) {
     string expected = "invalid category gun\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -415,12 +571,12 @@ TEST(InteractionsTest, BuyWeaponNotAvailableAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended())
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, buy_weapon)
-        .WillOnce(Throw(WeaponNotAvailableException()));
+    EXPECT_CALL(*mock_game_play, try_buy_weapon)
+        .WillOnce(Return(WEAPON_NOT_AVAILABLE));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -431,8 +587,9 @@ TEST(InteractionsTest, BuyAlreadyEquippedAssertions) {
     string expected = "you have a heavy\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
     Data::load();
 
     auto mock_game_play = make_shared<MockGamePlay>();
@@ -443,12 +600,12 @@ TEST(InteractionsTest, BuyAlreadyEquippedAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended())
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, buy_weapon)
-        .WillOnce(Throw(WeaponOfThisTypeAlreadyEquippedException()));
+    EXPECT_CALL(*mock_game_play, try_buy_weapon)
+        .WillOnce(Return(WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -459,8 +616,9 @@ TEST(InteractionsTest, BuyNotEnoughMoneyAssertions) {
     string expected = "no enough money\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -470,12 +628,12 @@ TEST(InteractionsTest, BuyNotEnoughMoneyAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended())
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, buy_weapon)
-        .WillOnce(Throw(NotEnoughMoneyException()));
+    EXPECT_CALL(*mock_game_play, try_buy_weapon)
+        .WillOnce(Return(NOT_ENOUGH_MONEY));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -486,8 +644,9 @@ TEST(InteractionsTest, TapAssertions) {
     string expected = "nice shot\nTerrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -499,12 +658,12 @@ TEST(InteractionsTest, TapAssertions) {
         .WillOnce(Return(true));
     EXPECT_CALL(*mock_game_play, set_round_time(60 * 1000))
         .Times(1);
-    EXPECT_CALL(*mock_game_play, attack_occurred("Attacker", "Attacked", HEAVY))
-        .Times(1);
+    EXPECT_CALL(*mock_game_play, try_attack_occurred("Attacker", "Attacked", HEAVY))
+        .WillOnce(Return(SUCCESS));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -515,8 +674,9 @@ TEST(InteractionsTest, TapNonExistingPlayerAssertions) {
     string expected = "invalid username\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -526,12 +686,12 @@ TEST(InteractionsTest, TapNonExistingPlayerAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, attack_occurred)
-        .WillOnce(Throw(PlayerNotFoundException()));
+    EXPECT_CALL(*mock_game_play, try_attack_occurred)
+        .WillOnce(Return(PLAYER_NOT_FOUND));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -542,8 +702,9 @@ TEST(InteractionsTest, TapDeadAttackerAssertions) {
     string expected = "attacker is dead\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -553,12 +714,12 @@ TEST(InteractionsTest, TapDeadAttackerAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, attack_occurred)
-        .WillOnce(Throw(ActionFromDeadPlayerException()));
+    EXPECT_CALL(*mock_game_play, try_attack_occurred)
+        .WillOnce(Return(ACTION_FROM_DEAD_PLAYER));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -569,8 +730,9 @@ TEST(InteractionsTest, TapDeadAttackedAssertions) {
     string expected = "attacked is dead\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -580,12 +742,12 @@ TEST(InteractionsTest, TapDeadAttackedAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, attack_occurred)
-        .WillOnce(Throw(AttackDeadPlayerException()));
+    EXPECT_CALL(*mock_game_play, try_attack_occurred)
+        .WillOnce(Return(ATTACK_DEAD_PLAYER));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -596,8 +758,9 @@ TEST(InteractionsTest, TapWeaponNotEquippedAssertions) {
     string expected = "no such gun\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -607,12 +770,12 @@ TEST(InteractionsTest, TapWeaponNotEquippedAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, attack_occurred)
-        .WillOnce(Throw(WeaponNotEquippedException()));
+    EXPECT_CALL(*mock_game_play, try_attack_occurred)
+        .WillOnce(Return(WEAPON_NOT_EQUIPPED));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -623,8 +786,9 @@ TEST(InteractionsTest, TapFriendlyFireAssertions) {
     string expected = "friendly fire\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -634,12 +798,12 @@ TEST(InteractionsTest, TapFriendlyFireAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, attack_occurred)
-        .WillOnce(Throw(FriendlyFireException()));
+    EXPECT_CALL(*mock_game_play, try_attack_occurred)
+        .WillOnce(Return(FRIENDLY_FIRE));
 
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
@@ -650,8 +814,9 @@ TEST(InteractionsTest, ScoreboardAssertions) {
     string expected = "Counter-Terrorist-Players:\n1 CT-1 3 1\n2 CT-2 0 0\nTerrorist-Players:\n1 Terrorist 1 3\nCounter-Terrorist won\n";
     stringstream input_stream(input);
     ostringstream output_stream;
-    Interactions::set_input_stream(input_stream);
-    Interactions::set_output_stream(output_stream);
+    Interactions interactions;
+    interactions.set_input_stream(input_stream);
+    interactions.set_output_stream(output_stream);
 
     auto mock_game_play = make_shared<MockGamePlay>();
 
@@ -659,28 +824,28 @@ TEST(InteractionsTest, ScoreboardAssertions) {
     auto mock_counter_terrorist2 = make_shared<MockPlayer>();
     auto mock_terrorist = make_shared<MockPlayer>();
 
-    auto counter_terrorists = vector<shared_ptr<Player>> {mock_counter_terrorist1, mock_counter_terrorist2};
-    auto terrorists = vector<shared_ptr<Player>> {mock_terrorist};
+    auto counter_terrorists = pmr::vector<shared_ptr<Player>> {mock_counter_terrorist1, mock_counter_terrorist2};
+    auto terrorists = pmr::vector<shared_ptr<Player>> {mock_terrorist};
 
     ON_CALL(*mock_game_play, determine_winner_and_go_next_round)
         .WillByDefault(Return(COUNTER_TERRORIST));
 
     ON_CALL(*mock_counter_terrorist1, get_name)
-        .WillByDefault(Return("CT-1"));
+        .WillByDefault(ReturnRefOfCopy(string("CT-1")));
     ON_CALL(*mock_counter_terrorist1, get_kills)
         .WillByDefault(Return(3));
     ON_CALL(*mock_counter_terrorist1, get_deaths)
         .WillByDefault(Return(1));
 
     ON_CALL(*mock_counter_terrorist2, get_name)
-        .WillByDefault(Return("CT-2"));
+        .WillByDefault(ReturnRefOfCopy(string("CT-2")));
     ON_CALL(*mock_counter_terrorist2, get_kills)
         .WillByDefault(Return(0));
     ON_CALL(*mock_counter_terrorist2, get_deaths)
         .WillByDefault(Return(0));
 
     ON_CALL(*mock_terrorist, get_name)
-        .WillByDefault(Return("Terrorist"));
+        .WillByDefault(ReturnRefOfCopy(string("Terrorist")));
     ON_CALL(*mock_terrorist, get_kills)
         .WillByDefault(Return(1));
     ON_CALL(*mock_terrorist, get_deaths)
@@ -689,14 +854,14 @@ TEST(InteractionsTest, ScoreboardAssertions) {
     EXPECT_CALL(*mock_game_play, has_ended)
         .WillOnce(Return(false))
         .WillOnce(Return(true));
-    EXPECT_CALL(*mock_game_play, get_scoreboard(COUNTER_TERRORIST))
-        .WillOnce(Return(counter_terrorists));
-    EXPECT_CALL(*mock_game_play, get_scoreboard(TERRORIST))
-        .WillOnce(Return(terrorists));
+    EXPECT_CALL(*mock_game_play, get_scoreboard_view(COUNTER_TERRORIST))
+        .WillOnce(ReturnRef(counter_terrorists));
+    EXPECT_CALL(*mock_game_play, get_scoreboard_view(TERRORIST))
+        .WillOnce(ReturnRef(terrorists));
     
-    Interactions::init();
-    Interactions::set_game_play(mock_game_play);
-    Interactions::begin();
+    interactions.init();
+    interactions.set_game_play(mock_game_play);
+    interactions.begin();
 
     string output = output_stream.str();
     EXPECT_EQ(output, expected);
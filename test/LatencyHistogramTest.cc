@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include "utils/metrics/LatencyHistogram.h"
+
+TEST(LatencyHistogramTest, BucketAssertions) {
+    for (ull value = 0; value < LatencyHistogram::SUB_BUCKETS; value++) {
+        EXPECT_EQ(LatencyHistogram::get_bucket_index(value), value);
+    }
+    EXPECT_EQ(LatencyHistogram::get_bucket_index(~0ULL), LatencyHistogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(LatencyHistogram::get_bucket_highest_value(LatencyHistogram::BUCKET_COUNT - 1), ~0ULL);
+
+    for (ull value : {16ULL, 17ULL, 31ULL, 32ULL, 33ULL, 1000ULL, 123456789ULL, 1ULL << 40}) {
+        size_t index = LatencyHistogram::get_bucket_index(value);
+        ull lowest = LatencyHistogram::get_bucket_lowest_value(index);
+        ull highest = LatencyHistogram::get_bucket_highest_value(index);
+        EXPECT_LE(lowest, value);
+        EXPECT_GE(highest, value);
+        EXPECT_LE(highest - lowest, value / LatencyHistogram::SUB_BUCKETS);
+        EXPECT_EQ(LatencyHistogram::get_bucket_index(highest + 1), index + 1);
+    }
+}
+
+TEST(LatencyHistogramTest, PercentileAssertions) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.get_count(), 0);
+    EXPECT_EQ(histogram.get_min(), 0);
+    EXPECT_EQ(histogram.get_value_at_percentile(99), 0);
+
+    for (ull value = 1; value <= 1000; value++) {
+        histogram.record(value);
+    }
+
+    EXPECT_EQ(histogram.get_count(), 1000);
+    EXPECT_EQ(histogram.get_min(), 1);
+    EXPECT_EQ(histogram.get_max(), 1000);
+    EXPECT_DOUBLE_EQ(histogram.get_mean(), 500.5);
+    EXPECT_EQ(histogram.get_value_at_percentile(0), 1);
+    EXPECT_NEAR(histogram.get_value_at_percentile(50), 500, 500 / LatencyHistogram::SUB_BUCKETS);
+    EXPECT_NEAR(histogram.get_value_at_percentile(99), 990, 990 / LatencyHistogram::SUB_BUCKETS);
+    EXPECT_EQ(histogram.get_value_at_percentile(100), 1000);
+}
+
+TEST(LatencyHistogramTest, MergeAssertions) {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    first.record(10);
+    first.record(20);
+    second.record(5000);
+
+    first.merge(second);
+
+    EXPECT_EQ(first.get_count(), 3);
+    EXPECT_EQ(first.get_min(), 10);
+    EXPECT_EQ(first.get_max(), 5000);
+    EXPECT_EQ(first.get_value_at_percentile(50), 20);
+
+    first.reset();
+    EXPECT_EQ(first.get_count(), 0);
+    EXPECT_EQ(first.get_max(), 0);
+}
@@ -0,0 +1,114 @@
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "utils/generator/MatchGenerator.h"
+#include "helpers/TextMatch.h"
+
+namespace {
+
+size_t count_occurrences(const string& text, const string& part) {
+    size_t count = 0;
+    for (size_t position = text.find(part); position != string::npos; position = text.find(part, position + 1)) {
+        count++;
+    }
+    return count;
+}
+
+}
+
+TEST(MatchGeneratorTest, ConstructionOutOfRangeAssertions) {
+    MatchGeneratorOptions options;
+
+    options.rounds = 0;
+    EXPECT_THROW(MatchGenerator generator(options), out_of_range);
+
+    options = MatchGeneratorOptions();
+    options.team_size = 0;
+    EXPECT_THROW(MatchGenerator generator(options), out_of_range);
+
+    options = MatchGeneratorOptions();
+    options.buy_weight = options.tap_weight = options.get_health_weight = options.get_money_weight = 0;
+    options.score_board_weight = 0;
+    EXPECT_THROW(MatchGenerator generator(options), out_of_range);
+
+    options = MatchGeneratorOptions();
+    options.invalid_ratio = 1.5;
+    EXPECT_THROW(MatchGenerator generator(options), out_of_range);
+}
+
+TEST(MatchGeneratorTest, DeterminismAssertions) {
+    MatchGeneratorOptions options;
+    options.seed = 42;
+    MatchGenerator generator(options);
+    MatchGenerator same_generator(options);
+    options.seed = 43;
+    MatchGenerator other_generator(options);
+
+    string text = generator.generate();
+
+    EXPECT_EQ(generator.generate(), text);
+    EXPECT_EQ(same_generator.generate(), text);
+    EXPECT_NE(other_generator.generate(), text);
+}
+
+TEST(MatchGeneratorTest, StructureAssertions) {
+    MatchGeneratorOptions options;
+    options.rounds = 3;
+    options.team_size = 2;
+    options.commands_per_round = 5;
+    MatchGenerator generator(options);
+
+    string text = generator.generate();
+
+    EXPECT_EQ(text.rfind("3\nROUND 9\n"
+                         "ADD-USER T0 Terrorist 00:00:000\n"
+                         "ADD-USER CT0 Counter-Terrorist 00:00:001\n"
+                         "ADD-USER T1 Terrorist 00:00:002\n"
+                         "ADD-USER CT1 Counter-Terrorist 00:00:003\n", 0), 0);
+    EXPECT_EQ(count_occurrences(text, "ROUND 5\n"), 2);
+    EXPECT_EQ(count(text.begin(), text.end(), '\n'), 1 + 3 + 4 + 3 * 5);
+    EXPECT_EQ(generator.get_command_count(), 4 + 3 * 5);
+}
+
+TEST(MatchGeneratorTest, PlayedMatchAssertions) {
+    Data::load();
+    MatchGeneratorOptions options;
+    options.rounds = 5;
+    options.team_size = 10;
+    options.commands_per_round = 200;
+    MatchGenerator generator(options);
+    ull command_count;
+
+    string output = play_text_match(generator.generate(), nullptr, &command_count);
+
+    EXPECT_EQ(command_count, generator.get_command_count());
+    EXPECT_EQ(count_occurrences(output, "this user added to "), 20);
+    EXPECT_EQ(count_occurrences(output, " won\n"), 5);
+    EXPECT_EQ(count_occurrences(output, "invalid username"), 0);
+    EXPECT_EQ(count_occurrences(output, "friendly fire"), 0);
+    EXPECT_EQ(count_occurrences(output, "invalid category gun"), 0);
+    EXPECT_GT(count_occurrences(output, "nice shot"), 0);
+}
+
+TEST(MatchGeneratorTest, InvalidCommandsAssertions) {
+    Data::load();
+    MatchGeneratorOptions options;
+    options.rounds = 2;
+    options.commands_per_round = 100;
+    options.buy_weight = 1;
+    options.tap_weight = 1;
+    options.get_health_weight = 0;
+    options.get_money_weight = 0;
+    options.score_board_weight = 0;
+    options.invalid_ratio = 1;
+    MatchGenerator generator(options);
+    ull command_count;
+
+    string output = play_text_match(generator.generate(), nullptr, &command_count);
+
+    EXPECT_EQ(count_occurrences(output, "invalid username") + count_occurrences(output, "friendly fire") +
+              count_occurrences(output, "invalid category gun"), 200);
+}
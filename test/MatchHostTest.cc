@@ -0,0 +1,82 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "helpers/TextMatch.h"
+#include "server/MatchHost.h"
+
+namespace {
+
+string create_match_input(int match) {
+    string terrorist = "T" + to_string(match);
+    string counter_terrorist = "CT" + to_string(match);
+    string input = "2\n";
+    input += "ROUND 4\n";
+    input += "ADD-USER " + terrorist + " Terrorist 00:01:000\n";
+    input += "ADD-USER " + counter_terrorist + " Counter-Terrorist 00:01:000\n";
+    input += "BUY " + terrorist + " AK 00:02:000\n";
+    input += "TAP " + terrorist + " " + counter_terrorist + " knife 00:05:000\n";
+    input += "ROUND " + to_string(match % 3 + 1) + "\n";
+    for (int i = 0; i <= match % 3; i++) {
+        input += "SCORE-BOARD 00:10:000\n";
+    }
+    return input;
+}
+
+}
+
+TEST(MatchHostTest, ConstructionOutOfRangeAssertions) {
+    EXPECT_THROW(MatchHost(0), out_of_range);
+}
+
+TEST(MatchHostTest, MatchOutputsAssertions) {
+    Data::load();
+    const int match_count = 50;
+    vector<string> inputs;
+    vector<ostringstream> outputs(match_count);
+    for (int i = 0; i < match_count; i++) {
+        inputs.push_back(create_match_input(i));
+    }
+
+    MatchHost host(4);
+    for (int i = 0; i < match_count; i++) {
+        host.submit(inputs[i], outputs[i]);
+    }
+    host.wait();
+
+    for (int i = 0; i < match_count; i++) {
+        EXPECT_EQ(outputs[i].str(), play_text_match(inputs[i]));
+    }
+
+    auto stats = host.get_stats();
+    EXPECT_EQ(host.get_worker_count(), 4);
+    EXPECT_EQ(stats.matches, match_count);
+    EXPECT_EQ(stats.failed_matches, 0);
+    EXPECT_EQ(stats.commands, match_count * 4 + 17 * 1 + 17 * 2 + 16 * 3);
+    EXPECT_GT(stats.matches_per_second(), 0);
+    EXPECT_GT(stats.commands_per_second(), 0);
+    EXPECT_EQ(host.get_latencies().get_round_end_histogram().get_count(), match_count * 2);
+    auto outcomes = host.get_outcomes();
+    EXPECT_EQ(outcomes.get_accepted() + outcomes.get_rejected(), stats.commands);
+    EXPECT_EQ(outcomes.get(ADD_USER, ACCEPTED_OUTCOME), match_count * 2);
+}
+
+TEST(MatchHostTest, FailedMatchAssertions) {
+    Data::load();
+    string valid_input = create_match_input(0);
+    string invalid_input = "1\nROUND 1\nJUMP Player 00:01:000\n";
+    ostringstream valid_output;
+    ostringstream invalid_output;
+
+    MatchHost host(2);
+    host.submit(valid_input, valid_output);
+    host.submit(invalid_input, invalid_output);
+    host.wait();
+
+    auto stats = host.get_stats();
+    EXPECT_EQ(stats.matches, 1);
+    EXPECT_EQ(stats.failed_matches, 1);
+}
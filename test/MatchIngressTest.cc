@@ -0,0 +1,162 @@
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+#include "server/MatchIngress.h"
+
+namespace {
+
+IngressCommand create_command(Command command, ull time, string player, string other_player = "",
+                              string weapon = "", Side side = TERRORIST, WeaponType weapon_type = MELEE) {
+    return IngressCommand {command, time, std::move(player), std::move(other_player), std::move(weapon), side,
+                           weapon_type, false};
+}
+
+}
+
+TEST(MatchIngressTest, SameOutputAsTextAssertions) {
+    Data::load();
+    string input = "1\n"
+                   "ROUND 9\n"
+                   "ADD-USER Terrorist Terrorist 00:01:000\n"
+                   "ADD-USER Counter-Terrorist Counter-Terrorist 00:01:000\n"
+                   "ADD-USER Unknown Spectator 00:01:500\n"
+                   "BUY Terrorist AK 00:02:000\n"
+                   "BUY Terrorist Zeus 00:02:500\n"
+                   "TAP Terrorist Counter-Terrorist heavy 00:05:000\n"
+                   "GET-HEALTH Counter-Terrorist 00:06:000\n"
+                   "GET-MONEY Nobody 00:07:000\n"
+                   "SCORE-BOARD 00:10:000\n";
+    ostringstream text_output;
+    Interactions text_interactions;
+    text_interactions.set_input_buffer(input);
+    text_interactions.set_output_stream(text_output);
+    text_interactions.init();
+    text_interactions.set_game_play(make_shared<GamePlay>(1));
+    text_interactions.begin();
+
+    ostringstream output;
+    Interactions interactions;
+    interactions.set_output_stream(output);
+    interactions.set_game_play(make_shared<GamePlay>(1));
+    MatchIngress ingress(interactions, 16);
+    IngressCommand rejected = create_command(ADD_USER, 1500, "Unknown");
+    rejected.rejected = true;
+    vector<IngressCommand> commands = {
+            create_command(ADD_USER, 1000, "Terrorist", "", "", TERRORIST),
+            create_command(ADD_USER, 1000, "Counter-Terrorist", "", "", COUNTER_TERRORIST),
+            rejected,
+            create_command(BUY, 2000, "Terrorist", "", "AK"),
+            create_command(BUY, 2500, "Terrorist", "", "Zeus"),
+            create_command(TAP, 5000, "Terrorist", "Counter-Terrorist", "", TERRORIST, HEAVY),
+            create_command(GET_HEALTH, 6000, "Counter-Terrorist"),
+            create_command(GET_MONEY, 7000, "Nobody"),
+            create_command(SCORE_BOARD, 10000, ""),
+    };
+    for (auto& command : commands) {
+        ASSERT_TRUE(ingress.try_submit(command));
+    }
+
+    EXPECT_EQ(ingress.drain(4), 4);
+    EXPECT_EQ(ingress.drain(100), commands.size() - 4);
+    EXPECT_EQ(ingress.drain(100), 0);
+    interactions.end_round();
+
+    EXPECT_EQ(output.str(), text_output.str());
+    EXPECT_EQ(interactions.get_command_count(), commands.size());
+}
+
+TEST(MatchIngressTest, InvalidArgumentsAssertions) {
+    Data::load();
+    vector<IngressCommand> commands = {
+            create_command(ADD_USER, 1000, "Terrorist", "", "", TERRORIST),
+            create_command(ADD_USER, 1000, "Counter-Terrorist", "", "", COUNTER_TERRORIST),
+            create_command(ADD_USER, 1500, "Nobody", "", "", static_cast<Side>(0)),
+            create_command(ADD_USER, 1500, "Everybody", "", "", ALL),
+            create_command(ADD_USER, 1500, "Somebody", "", "", static_cast<Side>(4)),
+            create_command(TAP, 2000, "Terrorist", "Counter-Terrorist", "", TERRORIST, static_cast<WeaponType>(0)),
+            create_command(TAP, 2000, "Terrorist", "Counter-Terrorist", "", TERRORIST, static_cast<WeaponType>(3)),
+            create_command(TAP, 2000, "Terrorist", "Counter-Terrorist", "", TERRORIST, static_cast<WeaponType>(8)),
+            create_command(static_cast<Command>(99), 2500, "Terrorist"),
+            create_command(TAP, 3000, "Terrorist", "Counter-Terrorist", "", TERRORIST, MELEE),
+    };
+    string outputs[2];
+    for (bool flagged : {false, true}) {
+        ostringstream output;
+        Interactions interactions;
+        interactions.set_output_stream(output);
+        interactions.set_game_play(make_shared<GamePlay>(1));
+        MatchIngress ingress(interactions, 16);
+        for (size_t i = 0; i < commands.size(); i++) {
+            IngressCommand command = commands[i];
+            command.rejected = flagged && i >= 2 && i < 9;
+            ASSERT_TRUE(ingress.try_submit(command));
+        }
+        EXPECT_EQ(ingress.drain(100), commands.size());
+        EXPECT_EQ(interactions.get_command_count(), commands.size());
+        EXPECT_EQ(interactions.get_game_play()->get_hp("Counter-Terrorist"), 57);
+        interactions.end_round();
+        outputs[flagged] = output.str();
+    }
+
+    EXPECT_EQ(outputs[0], outputs[1]);
+}
+
+TEST(MatchIngressTest, ManyProducersAssertions) {
+    Data::load();
+    const int producer_count = 4;
+    const int queries_per_producer = 2000;
+    ostringstream output;
+    Interactions interactions;
+    interactions.set_output_stream(output);
+    interactions.set_game_play(make_shared<GamePlay>(1));
+    MatchIngress ingress(interactions, 32);
+    EXPECT_EQ(ingress.get_capacity(), 32);
+
+    vector<thread> producers;
+    for (int producer = 0; producer < producer_count; producer++) {
+        producers.emplace_back([&ingress, producer] {
+            string name = "Player" + to_string(producer);
+            auto command = create_command(ADD_USER, 1000, name, "", "", producer % 2 ? TERRORIST : COUNTER_TERRORIST);
+            while (!ingress.try_submit(command)) {
+                this_thread::yield();
+            }
+            for (int i = 0; i < queries_per_producer; i++) {
+                command = create_command(GET_MONEY, 2000, name);
+                while (!ingress.try_submit(command)) {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+
+    size_t total_commands = producer_count * (queries_per_producer + 1);
+    for (size_t drained = 0; drained < total_commands;) {
+        size_t batch = ingress.drain(8);
+        if (batch == 0) {
+            this_thread::yield();
+        }
+        drained += batch;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    interactions.end_round();
+
+    istringstream lines(output.str());
+    string line;
+    size_t added = 0, moneys = 0;
+    while (getline(lines, line)) {
+        added += line.rfind("this user added to ", 0) == 0;
+        moneys += line == "1000";
+    }
+    EXPECT_EQ(added, producer_count);
+    EXPECT_EQ(moneys, producer_count * queries_per_producer);
+    EXPECT_EQ(interactions.get_command_count(), total_commands);
+}
@@ -0,0 +1,203 @@
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "utils/generator/MatchGenerator.h"
+#include "utils/matchlog/MatchLogReader.h"
+#include "utils/matchlog/MatchLogWriter.h"
+#include "helpers/TextMatch.h"
+#include "MatchLogReplayer.h"
+
+namespace {
+
+string replay(const string& log, ull& command_count) {
+    ostringstream output;
+    MatchLogReplayer replayer(log, output);
+    replayer.replay();
+    command_count = replayer.get_command_count();
+    return output.str();
+}
+
+}
+
+TEST(MatchLogTest, RecordsAssertions) {
+    ostringstream log_stream;
+    MatchLogWriter writer(log_stream);
+
+    writer.begin_match(2);
+    writer.begin_round(4);
+    writer.add_user("Player", TERRORIST, 1000);
+    writer.buy("Player", "AK", 300);
+    writer.tap("Player", "Other", HEAVY, 70000);
+    writer.reject(70001);
+    writer.begin_round(1);
+    writer.get_money("Other", 5);
+    writer.flush();
+
+    string log = log_stream.str();
+    MatchLogReader reader(log);
+    MatchLogRecord record;
+
+    EXPECT_EQ(reader.get_rounds(), 2);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, ROUND_RECORD);
+    EXPECT_EQ(record.command_count, 4);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, ADD_USER_RECORD);
+    EXPECT_EQ(record.time, 1000);
+    EXPECT_EQ(reader.get_player_name(record.player), "Player");
+    EXPECT_EQ(record.side, TERRORIST);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, BUY_RECORD);
+    EXPECT_EQ(record.time, 300);
+    EXPECT_EQ(reader.get_player_name(record.player), "Player");
+    EXPECT_EQ(reader.get_weapon_name(record.weapon), "AK");
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, TAP_RECORD);
+    EXPECT_EQ(record.time, 70000);
+    EXPECT_EQ(reader.get_player_name(record.player), "Player");
+    EXPECT_EQ(reader.get_player_name(record.other_player), "Other");
+    EXPECT_EQ(record.weapon_type, HEAVY);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, REJECTED_RECORD);
+    EXPECT_EQ(record.time, 70001);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, ROUND_RECORD);
+    EXPECT_EQ(record.command_count, 1);
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, GET_MONEY_RECORD);
+    EXPECT_EQ(record.time, 5);
+    EXPECT_EQ(record.player, 1);
+
+    EXPECT_FALSE(reader.next(record));
+    EXPECT_EQ(reader.get_player_count(), 2);
+    EXPECT_EQ(reader.get_weapon_count(), 1);
+}
+
+TEST(MatchLogTest, InvalidLogAssertions) {
+    ostringstream log_stream;
+    MatchLogWriter writer(log_stream);
+    writer.begin_match(1);
+    writer.begin_round(1);
+    writer.buy("Player", "AWP", 1000);
+    writer.flush();
+    string log = log_stream.str();
+    MatchLogRecord record;
+
+    EXPECT_THROW(MatchLogReader("1\nROUND 1\n"), invalid_argument);
+    EXPECT_THROW(MatchLogReader(log.substr(0, 4)), invalid_argument);
+
+    MatchLogReader truncated_reader(string_view(log).substr(0, log.size() - 2));
+    ASSERT_TRUE(truncated_reader.next(record));
+    EXPECT_THROW(truncated_reader.next(record), invalid_argument);
+
+    for (uint side : {0, 3, 4}) {
+        ostringstream side_log_stream;
+        MatchLogWriter side_writer(side_log_stream);
+        side_writer.begin_match(1);
+        side_writer.begin_round(1);
+        side_writer.add_user("Player", static_cast<Side>(side), 1000);
+        side_writer.flush();
+        string side_log = side_log_stream.str();
+        MatchLogReader side_reader(side_log);
+        ASSERT_TRUE(side_reader.next(record));
+        EXPECT_THROW(side_reader.next(record), invalid_argument);
+    }
+
+    for (uint weapon_type : {0, 3, 8}) {
+        ostringstream tap_log_stream;
+        MatchLogWriter tap_writer(tap_log_stream);
+        tap_writer.begin_match(1);
+        tap_writer.begin_round(1);
+        tap_writer.tap("Player", "Other", static_cast<WeaponType>(weapon_type), 1000);
+        tap_writer.flush();
+        string tap_log = tap_log_stream.str();
+        MatchLogReader tap_reader(tap_log);
+        ASSERT_TRUE(tap_reader.next(record));
+        EXPECT_THROW(tap_reader.next(record), invalid_argument);
+    }
+}
+
+TEST(MatchLogTest, ReplayAssertions) {
+    Data::load();
+    string input = "2\n"
+                   "ROUND 9\n"
+                   "ADD-USER Terrorist Terrorist 00:01:000\n"
+                   "ADD-USER Counter-Terrorist Counter-Terrorist 00:01:500\n"
+                   "ADD-USER Terrorist Counter-Terrorist 00:01:700\n"
+                   "ADD-USER Spectator Spectators 00:02:000\n"
+                   "BUY Terrorist Revolver 00:10:000\n"
+                   "BUY Terrorist Laser 00:11:000\n"
+                   "TAP Terrorist Counter-Terrorist pistol 00:20:000\n"
+                   "TAP Terrorist Counter-Terrorist spoon 00:21:000\n"
+                   "TAP Terrorist Counter-Terrorist pistol 00:22:000\n"
+                   "ROUND 4\n"
+                   "GET-MONEY Terrorist 00:01:000\n"
+                   "GET-HEALTH Nobody 00:01:000\n"
+                   "BUY Terrorist AWP 00:50:000\n"
+                   "SCORE-BOARD 01:00:000\n";
+    ull command_count;
+
+    ostringstream log_stream;
+    string output = play_text_match(input, &log_stream);
+    string log = log_stream.str();
+
+    EXPECT_EQ(replay(log, command_count), output);
+    EXPECT_EQ(command_count, 13);
+    EXPECT_LT(log.size(), input.size() / 2);
+}
+
+TEST(MatchLogTest, TapBurstReplayAssertions) {
+    Data::load();
+    string input = "1\n"
+                   "ROUND 12\n"
+                   "ADD-USER Terrorist Terrorist 00:01:000\n"
+                   "ADD-USER Other-Terrorist Terrorist 00:01:000\n"
+                   "ADD-USER Counter-Terrorist Counter-Terrorist 00:01:000\n"
+                   "TAP Terrorist Counter-Terrorist knife 00:20:000\n"
+                   "TAP Nobody Counter-Terrorist knife 00:20:000\n"
+                   "TAP Terrorist Counter-Terrorist knife 00:20:000\n"
+                   "GET-HEALTH Counter-Terrorist 00:20:000\n"
+                   "TAP Other-Terrorist Counter-Terrorist knife 00:20:000\n"
+                   "TAP Counter-Terrorist Terrorist knife 00:20:000\n"
+                   "TAP Terrorist Counter-Terrorist knife 00:21:000\n"
+                   "TAP Terrorist Other-Terrorist knife 00:21:000\n"
+                   "SCORE-BOARD 00:22:000\n";
+    ull command_count;
+
+    ostringstream log_stream;
+    string output = play_text_match(input, &log_stream);
+    string log = log_stream.str();
+
+    EXPECT_EQ(replay(log, command_count), output);
+    EXPECT_EQ(command_count, 12);
+}
+
+TEST(MatchLogTest, GeneratedMatchReplayAssertions) {
+    Data::load();
+    MatchGeneratorOptions options;
+    options.rounds = 10;
+    options.team_size = 10;
+    options.commands_per_round = 500;
+    options.invalid_ratio = 0.2;
+    MatchGenerator generator(options);
+    string input = generator.generate();
+    ull command_count;
+
+    ostringstream log_stream;
+    string output = play_text_match(input, &log_stream);
+    string log = log_stream.str();
+
+    EXPECT_EQ(replay(log, command_count), output);
+    EXPECT_EQ(command_count, generator.get_command_count());
+    EXPECT_LT(log.size(), input.size() / 3);
+}
@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "utils/data/Data.h"
+#include "utils/metrics/OutcomeCounters.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+
+TEST(OutcomeCountersTest, InteractionsAssertions) {
+    Data::load();
+    string input = "1\n"
+                   "ROUND 9\n"
+                   "ADD-USER Player Terrorist 00:01:000\n"
+                   "ADD-USER Player Terrorist 00:01:000\n"
+                   "ADD-USER Other Counter-Terrorist 00:01:000\n"
+                   "ADD-USER Nobody Spectator 00:01:000\n"
+                   "GET-MONEY Player 00:02:000\n"
+                   "GET-HEALTH Ghost 00:02:000\n"
+                   "BUY Player Unknown 00:03:000\n"
+                   "TAP Player Other knife 00:05:000\n"
+                   "TAP Player Other bazooka 00:05:000\n";
+    ostringstream output;
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output);
+    interactions.init();
+    interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds()));
+    interactions.begin();
+    interactions.reject(6000);
+
+    const OutcomeCounters& outcomes = interactions.get_outcomes();
+    EXPECT_EQ(outcomes.get(ADD_USER, ACCEPTED_OUTCOME), 2);
+    EXPECT_EQ(outcomes.get(ADD_USER, PLAYER_ALREADY_IN_GAME_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get(ADD_USER, INVALID_ARGUMENTS_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get(GET_MONEY, ACCEPTED_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get(GET_HEALTH, PLAYER_NOT_FOUND_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get(BUY, WEAPON_NOT_FOUND_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get(TAP, ACCEPTED_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get(TAP, INVALID_ARGUMENTS_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get(OutcomeCounters::UNPARSED_ROW, INVALID_ARGUMENTS_OUTCOME), 1);
+    EXPECT_EQ(outcomes.get_accepted(), 4);
+    EXPECT_EQ(outcomes.get_rejected(), 6);
+}
+
+TEST(OutcomeCountersTest, ActionResultAssertions) {
+    EXPECT_EQ(OutcomeCounters::get_outcome(SUCCESS), ACCEPTED_OUTCOME);
+    EXPECT_EQ(OutcomeCounters::get_outcome(FRIENDLY_FIRE), FRIENDLY_FIRE_OUTCOME);
+    EXPECT_EQ(OutcomeCounters::get_outcome(NOT_ENOUGH_MONEY), NOT_ENOUGH_MONEY_OUTCOME);
+    EXPECT_EQ(OutcomeCounters::get_outcome(WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED),
+              WEAPON_OF_THIS_TYPE_ALREADY_EQUIPPED_OUTCOME);
+}
+
+TEST(OutcomeCountersTest, PrometheusAssertions) {
+    OutcomeCounters outcomes;
+    outcomes.count(BUY, ACCEPTED_OUTCOME);
+    outcomes.count(BUY, NOT_ENOUGH_MONEY_OUTCOME);
+    OutcomeCounters other;
+    other.add(BUY, NOT_ENOUGH_MONEY_OUTCOME, 2);
+    outcomes.merge(other);
+
+    ostringstream stream;
+    outcomes.write_prometheus(stream);
+    string text = stream.str();
+
+    EXPECT_EQ(text.find("# TYPE csxd_commands_total counter\n"), text.find('\n') + 1);
+    EXPECT_NE(text.find("csxd_commands_total{command=\"BUY\",outcome=\"accepted\"} 1\n"), string::npos);
+    EXPECT_NE(text.find("csxd_commands_total{command=\"BUY\",outcome=\"not_enough_money\"} 3\n"), string::npos);
+    EXPECT_NE(text.find("csxd_commands_total{command=\"TAP\",outcome=\"accepted\"} 0\n"), string::npos);
+    EXPECT_EQ(text.find("friendly_fire"), string::npos);
+
+    string path = testing::TempDir() + "outcomes.prom";
+    outcomes.write_prometheus_file(path);
+    ifstream file(path);
+    stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), text);
+    EXPECT_FALSE(ifstream(path + ".tmp").good());
+    remove(path.c_str());
+}
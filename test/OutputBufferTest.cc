@@ -0,0 +1,66 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "utils/output/OutputBuffer.h"
+
+TEST(OutputBufferTest, FormattingAssertions) {
+    ostringstream stream;
+    OutputBuffer out(stream);
+
+    out << "rank " << 1u << ' ' << 18446744073709551615ull << ' ' << 0u << '\n';
+    out.flush();
+
+    EXPECT_EQ(stream.str(), "rank 1 18446744073709551615 0\n");
+}
+
+TEST(OutputBufferTest, BufferingAssertions) {
+    ostringstream stream;
+    OutputBuffer out(stream);
+
+    out << "nice shot" << '\n';
+
+    EXPECT_EQ(stream.str(), "");
+    EXPECT_EQ(out.get_pending_size(), 10);
+
+    out.flush();
+
+    EXPECT_EQ(stream.str(), "nice shot\n");
+    EXPECT_EQ(out.get_pending_size(), 0);
+}
+
+TEST(OutputBufferTest, ThresholdAssertions) {
+    ostringstream stream;
+    OutputBuffer out(stream, 8);
+
+    out << "1234";
+    EXPECT_EQ(stream.str(), "");
+
+    out << "5678";
+    EXPECT_EQ(stream.str(), "12345678");
+    EXPECT_EQ(out.get_pending_size(), 0);
+}
+
+TEST(OutputBufferTest, ResetAssertions) {
+    ostringstream first_stream;
+    ostringstream second_stream;
+    OutputBuffer out(first_stream);
+
+    out << "first";
+    out.reset(second_stream);
+    out << "second";
+    out.flush();
+
+    EXPECT_EQ(first_stream.str(), "first");
+    EXPECT_EQ(second_stream.str(), "second");
+}
+
+TEST(OutputBufferTest, FlushOnDestructionAssertions) {
+    ostringstream stream;
+    {
+        OutputBuffer out(stream);
+        out << "pending";
+    }
+
+    EXPECT_EQ(stream.str(), "pending");
+}
@@ -0,0 +1,68 @@
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "models/player/PlayerStore.h"
+
+namespace {
+
+/// Players of both sides in a random order, with money near and at the cap and some dead
+PlayerStore create_store(size_t count, mt19937& random) {
+    PlayerStore store;
+    uniform_int_distribution<uint> hp(0, 100);
+    uniform_int_distribution<uint> money(0, 10000);
+    for (size_t i = 0; i < count; i++) {
+        Side side = random() % 2 == 0 ? COUNTER_TERRORIST : TERRORIST;
+        uint max_money = i % 7 == 0 ? 0xFFFFFFFF : 10000;
+        store.add(hp(random), max_money, i % 5 == 0 ? max_money : money(random), 0, 0, side, i);
+    }
+    return store;
+}
+
+}
+
+TEST(PlayerStoreTest, ResetHpAndAddMoneyAssertions) {
+    PlayerStore store;
+    store.add(0, 10000, 9000, 0, 0, TERRORIST, 0);
+    store.add(40, 10000, 1000, 0, 0, COUNTER_TERRORIST, 0);
+    store.add(70, 10000, 9999, 0, 0, TERRORIST, 0);
+
+    store.reset_hp_and_add_money(TERRORIST, 2700);
+
+    EXPECT_EQ(store.hp(0), 100);
+    EXPECT_EQ(store.money(0), 10000);
+    EXPECT_EQ(store.hp(1), 40);
+    EXPECT_EQ(store.money(1), 1000);
+    EXPECT_EQ(store.hp(2), 100);
+    EXPECT_EQ(store.money(2), 10000);
+    EXPECT_EQ(store.count_alive(ALL), 3);
+}
+
+TEST(PlayerStoreTest, KernelsMatchScalarAssertions) {
+    EXPECT_TRUE(is_settlement_kernel_supported(SCALAR_KERNEL));
+    EXPECT_TRUE(is_settlement_kernel_supported(get_best_settlement_kernel()));
+
+    mt19937 random(2023);
+    for (SettlementKernel kernel : {SSE41_KERNEL, AVX2_KERNEL}) {
+        if (!is_settlement_kernel_supported(kernel)) {
+            continue;
+        }
+        for (size_t count : {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 33, 1000}) {
+            for (Side side : {COUNTER_TERRORIST, TERRORIST, ALL}) {
+                auto seed = random();
+                mt19937 scalar_random(seed);
+                mt19937 kernel_random(seed);
+                PlayerStore scalar_store = create_store(count, scalar_random);
+                PlayerStore kernel_store = create_store(count, kernel_random);
+
+                scalar_store.reset_hp_and_add_money(side, 3250, SCALAR_KERNEL);
+                kernel_store.reset_hp_and_add_money(side, 3250, kernel);
+
+                for (uint id = 0; id < count; id++) {
+                    ASSERT_EQ(kernel_store.hp(id), scalar_store.hp(id)) << kernel << " " << count << " " << id;
+                    ASSERT_EQ(kernel_store.money(id), scalar_store.money(id)) << kernel << " " << count << " " << id;
+                }
+            }
+        }
+    }
+}
@@ -181,6 +181,17 @@ TEST(PlayerTest, SubtractMoneyNotEnoughMoneyAssertions) {
     EXPECT_THROW(player.subtract_money(4000), NotEnoughMoneyException);
 }
 
+TEST(PlayerTest, TrySubtractMoneyAssertions) {
+    Player player("Player", 63, 10000, 0, TERRORIST, 2023);
+
+    player.add_money(3000);
+
+    EXPECT_FALSE(player.try_subtract_money(4000));
+    EXPECT_EQ(player.get_money(), 3000);
+    EXPECT_TRUE(player.try_subtract_money(2000));
+    EXPECT_EQ(player.get_money(), 1000);
+}
+
 TEST(PlayerTest, AddKillAssertions) {
     Player player("Player", 63, 10000, 0, TERRORIST, 2023);
 
@@ -206,13 +217,13 @@ TEST(PlayerTest, EquipWeaponAssertions) {
     shared_ptr<Weapon> pistol = make_shared<Weapon>("Pistol", 1000, 10, 100, PISTOL, TERRORIST);
     shared_ptr<Weapon> heavy = make_shared<Weapon>("Heavy", 1000, 10, 100, HEAVY, TERRORIST);
 
-    player.equip_weapon(melee);
-    player.equip_weapon(pistol);
-    player.equip_weapon(heavy);
+    player.equip_weapon(melee.get());
+    player.equip_weapon(pistol.get());
+    player.equip_weapon(heavy.get());
 
-    EXPECT_EQ(player.get_weapon(MELEE), melee);
-    EXPECT_EQ(player.get_weapon(PISTOL), pistol);
-    EXPECT_EQ(player.get_weapon(HEAVY), heavy);
+    EXPECT_EQ(player.get_weapon(MELEE), melee.get());
+    EXPECT_EQ(player.get_weapon(PISTOL), pistol.get());
+    EXPECT_EQ(player.get_weapon(HEAVY), heavy.get());
 }
 
 TEST(PlayerTest, EquipNullWeaponAssertions) {
@@ -226,9 +237,9 @@ TEST(PlayerTest, EquipWeaponTwiceAssertions) {
 
     shared_ptr<Weapon> pistol = make_shared<Weapon>("Pistol", 1000, 10, 100, PISTOL, TERRORIST);
 
-    player.equip_weapon(pistol);
+    player.equip_weapon(pistol.get());
 
-    EXPECT_NO_THROW(player.equip_weapon(pistol));
+    EXPECT_NO_THROW(player.equip_weapon(pistol.get()));
 }
 
 TEST(PlayerTest, GetDroppedWeaponAssertions) {
@@ -236,7 +247,7 @@ TEST(PlayerTest, GetDroppedWeaponAssertions) {
 
     shared_ptr<Weapon> pistol = make_shared<Weapon>("Pistol", 1000, 10, 100, PISTOL, TERRORIST);
 
-    player.equip_weapon(pistol);
+    player.equip_weapon(pistol.get());
     player.drop_weapon(PISTOL);
 
     EXPECT_THROW(player.get_weapon(MELEE), WeaponNotEquippedException);
@@ -246,4 +257,72 @@ TEST(PlayerTest, DropNonEquippedWeaponAssertions) {
     Player player("Player", 63, 10000, 0, TERRORIST, 2023);
 
     EXPECT_THROW(player.drop_weapon(MELEE), WeaponNotEquippedException);
-}
\ No newline at end of file
+}
+
+TEST(PlayerTest, FindWeaponAssertions) {
+    Player player("Player", 63, 10000, 0, TERRORIST, 2023);
+
+    shared_ptr<Weapon> pistol = make_shared<Weapon>("Pistol", 1000, 10, 100, PISTOL, TERRORIST);
+
+    player.equip_weapon(pistol.get());
+
+    EXPECT_EQ(player.find_weapon(PISTOL), pistol.get());
+    EXPECT_EQ(player.find_weapon(HEAVY), nullptr);
+}
+
+TEST(PlayerTest, TryDropWeaponAssertions) {
+    Player player("Player", 63, 10000, 0, TERRORIST, 2023);
+
+    shared_ptr<Weapon> pistol = make_shared<Weapon>("Pistol", 1000, 10, 100, PISTOL, TERRORIST);
+
+    player.equip_weapon(pistol.get());
+
+    EXPECT_TRUE(player.try_drop_weapon(PISTOL));
+    EXPECT_FALSE(player.try_drop_weapon(PISTOL));
+    EXPECT_EQ(player.find_weapon(PISTOL), nullptr);
+}
+
+TEST(PlayerTest, InvalidWeaponTypeAssertions) {
+    Player player("Player", 63, 10000, 0, TERRORIST, 2023);
+
+    shared_ptr<Weapon> melee = make_shared<Weapon>("Melee", 1000, 10, 100, MELEE, TERRORIST);
+    shared_ptr<Weapon> pistol = make_shared<Weapon>("Pistol", 1000, 10, 100, PISTOL, TERRORIST);
+    shared_ptr<Weapon> invalid = make_shared<Weapon>("Invalid", 1000, 10, 100, static_cast<WeaponType>(3), TERRORIST);
+
+    player.equip_weapon(melee.get());
+    player.equip_weapon(pistol.get());
+
+    for (uint type : {0, 3, 8}) {
+        EXPECT_EQ(player.find_weapon(static_cast<WeaponType>(type)), nullptr);
+        EXPECT_FALSE(player.try_drop_weapon(static_cast<WeaponType>(type)));
+    }
+    EXPECT_THROW(player.equip_weapon(invalid.get()), invalid_argument);
+    EXPECT_EQ(player.find_weapon(MELEE), melee.get());
+    EXPECT_EQ(player.find_weapon(PISTOL), pistol.get());
+}
+
+TEST(PlayerTest, WeaponSlotsAssertions) {
+    Player player("Player", 63, 10000, 0, TERRORIST, 2023);
+
+    shared_ptr<Weapon> melee = make_shared<Weapon>("Melee", 1000, 10, 100, MELEE, TERRORIST);
+    shared_ptr<Weapon> pistol = make_shared<Weapon>("Pistol", 1000, 10, 100, PISTOL, TERRORIST);
+    shared_ptr<Weapon> other_pistol = make_shared<Weapon>("Other-Pistol", 1000, 10, 100, PISTOL, TERRORIST);
+    shared_ptr<Weapon> heavy = make_shared<Weapon>("Heavy", 1000, 10, 100, HEAVY, TERRORIST);
+
+    player.equip_weapon(melee.get());
+    player.equip_weapon(pistol.get());
+    player.equip_weapon(other_pistol.get());
+    player.equip_weapon(heavy.get());
+
+    EXPECT_EQ(player.find_weapon(PISTOL), other_pistol.get());
+
+    EXPECT_TRUE(player.try_drop_weapon(PISTOL));
+
+    EXPECT_EQ(player.find_weapon(MELEE), melee.get());
+    EXPECT_EQ(player.find_weapon(PISTOL), nullptr);
+    EXPECT_EQ(player.find_weapon(HEAVY), heavy.get());
+    EXPECT_FALSE(player.try_drop_weapon(PISTOL));
+    EXPECT_TRUE(player.try_drop_weapon(HEAVY));
+    EXPECT_TRUE(player.try_drop_weapon(MELEE));
+    EXPECT_EQ(player.find_weapon(MELEE), nullptr);
+}
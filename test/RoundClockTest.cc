@@ -0,0 +1,113 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "server/RoundClock.h"
+#include "utils/data/Data.h"
+#include "exceptions/NullPointerException.h"
+
+using ::testing::ElementsAre;
+
+namespace {
+
+class RecordingRoundObserver : public RoundObserver {
+public:
+    explicit RecordingRoundObserver(const RoundClock& clock) : clock(clock) { }
+
+    void on_entry_closed(uint match) override {
+        events.push_back(to_string(clock.get_time()) + " " + to_string(match) + " entry closed");
+    }
+
+    void on_buy_time_ended(uint match) override {
+        events.push_back(to_string(clock.get_time()) + " " + to_string(match) + " buy time ended");
+    }
+
+    void on_round_ended(uint match, Side winner_side, bool match_ended) override {
+        events.push_back(to_string(clock.get_time()) + " " + to_string(match) +
+                         (winner_side == TERRORIST ? " terrorist won" : " counter-terrorist won") +
+                         (match_ended ? ", match ended" : ""));
+    }
+
+    const RoundClock& clock;
+    vector<string> events;
+};
+
+}
+
+TEST(RoundClockTest, PhasesAssertions) {
+    Data::load();
+    RoundClock clock(1000);
+    RecordingRoundObserver observer(clock);
+    GamePlay game_play(2);
+    game_play.add_player(game_play.create_player("Terrorist", TERRORIST));
+
+    uint match = clock.add_match(&game_play, &observer);
+    EXPECT_EQ(clock.get_match_count(), 1);
+
+    clock.advance(3999);
+    EXPECT_TRUE(observer.events.empty());
+    EXPECT_EQ(clock.get_round_time(match), 2999);
+    clock.update_round_time(match);
+    EXPECT_EQ(game_play.create_player("Early", TERRORIST)->get_hp(), 100);
+
+    EXPECT_EQ(clock.advance(4000), 1);
+    EXPECT_EQ(game_play.create_player("Late", TERRORIST)->get_hp(), 0);
+
+    clock.advance(46000);
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", Data::get_weapon_by_name("AK")), ACTION_AT_ILLEGAL_TIME);
+
+    clock.advance(1000 + 135 * 1000);
+    EXPECT_EQ(clock.get_round_time(match), 0);
+    EXPECT_EQ(game_play.try_buy_weapon("Terrorist", Data::get_weapon_by_name("AK")), SUCCESS);
+
+    clock.advance(1000 + 10 * 135 * 1000);
+    EXPECT_THAT(observer.events, ElementsAre("4000 0 entry closed", "46000 0 buy time ended",
+                                             "136000 0 terrorist won", "139000 0 entry closed",
+                                             "181000 0 buy time ended", "271000 0 terrorist won, match ended"));
+    EXPECT_TRUE(game_play.has_ended());
+    EXPECT_FALSE(clock.has_match(match));
+    EXPECT_EQ(clock.get_match_count(), 0);
+}
+
+TEST(RoundClockTest, ManyMatchesAssertions) {
+    Data::load();
+    RoundClock clock(0);
+    RecordingRoundObserver observer(clock);
+    vector<unique_ptr<GamePlay>> game_plays;
+    vector<uint> matches;
+
+    for (uint i = 0; i < 100; i++) {
+        clock.advance(i * 10);
+        game_plays.push_back(make_unique<GamePlay>(3));
+        matches.push_back(clock.add_match(game_plays.back().get(), &observer));
+    }
+    clock.remove_match(matches[1]);
+    EXPECT_EQ(clock.get_match_count(), 99);
+    EXPECT_THROW(clock.get_round_time(matches[1]), out_of_range);
+    EXPECT_THROW(clock.remove_match(matches[1]), out_of_range);
+
+    clock.advance(135 * 1000 + 50);
+    EXPECT_EQ(count(observer.events.begin(), observer.events.end(), "135000 0 counter-terrorist won"), 1);
+    EXPECT_EQ(count(observer.events.begin(), observer.events.end(), "135050 5 counter-terrorist won"), 1);
+
+    size_t phases = clock.advance(3 * 135 * 1000 + 990);
+    EXPECT_EQ(phases, 99 * 9 - (5 * 3 + 94 * 2));
+    EXPECT_EQ(clock.get_match_count(), 0);
+    for (uint i = 0; i < game_plays.size(); i++) {
+        EXPECT_EQ(game_plays[i]->has_ended(), i != 1);
+    }
+}
+
+TEST(RoundClockTest, AddMatchAssertions) {
+    Data::load();
+    RoundClock clock;
+    EXPECT_THROW(clock.add_match(nullptr), NullPointerException);
+
+    GamePlay game_play(1);
+    game_play.determine_winner_and_go_next_round();
+    EXPECT_THROW(clock.add_match(&game_play), invalid_argument);
+    EXPECT_FALSE(clock.has_match(0));
+}
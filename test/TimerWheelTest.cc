@@ -0,0 +1,122 @@
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "server/TimerWheel.h"
+
+using ::testing::ElementsAre;
+
+TEST(TimerWheelTest, FiresInDeadlineOrderAssertions) {
+    TimerWheel wheel(1000);
+    vector<pair<ull, ull>> fired;
+    auto record = [&](ull token) { fired.emplace_back(wheel.get_time(), token); };
+
+    ull far_away = 1000 + (1ull << (TimerWheel::LEVELS * TimerWheel::SLOT_BITS)) * 3 + 17;
+    for (ull deadline : {far_away, 1000 + 64ull * 64 * 64 + 5, 1000 + 64ull * 64, 1000 + 64ull, 1005ull, 1001ull}) {
+        wheel.schedule(deadline, deadline);
+    }
+    wheel.schedule(500, 1);
+    EXPECT_EQ(wheel.size(), 7);
+
+    EXPECT_EQ(wheel.advance(1000, record), 0);
+    EXPECT_EQ(wheel.advance(1004, record), 2);
+    EXPECT_THAT(fired, ElementsAre(pair<ull, ull>(1001, 1), pair<ull, ull>(1001, 1001)));
+
+    fired.clear();
+    wheel.advance(far_away, record);
+    EXPECT_THAT(fired, ElementsAre(pair<ull, ull>(1005, 1005), pair<ull, ull>(1064, 1064),
+                                   pair<ull, ull>(1000 + 64 * 64, 1000 + 64 * 64),
+                                   pair<ull, ull>(1000 + 64 * 64 * 64 + 5, 1000 + 64 * 64 * 64 + 5),
+                                   pair<ull, ull>(far_away, far_away)));
+    EXPECT_EQ(wheel.size(), 0);
+    EXPECT_EQ(wheel.get_time(), far_away);
+}
+
+TEST(TimerWheelTest, MatchesDeadlinesAcrossLevelsAssertions) {
+    TimerWheel wheel(7);
+    vector<ull> deadlines;
+    for (ull i = 0; i < 2000; i++) {
+        deadlines.push_back(8 + (i * i * 7919) % 300000);
+        wheel.schedule(deadlines.back(), deadlines.back());
+    }
+
+    size_t fired = 0;
+    wheel.advance(400000, [&](ull deadline) {
+        EXPECT_EQ(wheel.get_time(), deadline);
+        fired++;
+    });
+    EXPECT_EQ(fired, deadlines.size());
+}
+
+TEST(TimerWheelTest, CancelAssertions) {
+    TimerWheel wheel;
+    vector<ull> fired;
+    auto record = [&](ull token) { fired.push_back(token); };
+
+    TimerId first = wheel.schedule(10, 1);
+    TimerId second = wheel.schedule(10, 2);
+    TimerId third = wheel.schedule(100000, 3);
+    EXPECT_TRUE(wheel.cancel(second));
+    EXPECT_FALSE(wheel.cancel(second));
+    EXPECT_TRUE(wheel.cancel(third));
+    EXPECT_EQ(wheel.size(), 1);
+
+    TimerId reused = wheel.schedule(20, 4);
+    EXPECT_NE(reused, second);
+    EXPECT_FALSE(wheel.cancel(second));
+
+    wheel.advance(100000, record);
+    EXPECT_THAT(fired, ElementsAre(1, 4));
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_FALSE(wheel.cancel(12345));
+}
+
+TEST(TimerWheelTest, CallbackSchedulesAndCancelsAssertions) {
+    TimerWheel wheel;
+    vector<pair<ull, ull>> fired;
+    TimerId cancelled = 0;
+
+    wheel.schedule(5, 1);
+    wheel.schedule(5, 2);
+    wheel.schedule(5, 3);
+    wheel.advance(50, [&](ull token) {
+        fired.emplace_back(wheel.get_time(), token);
+        if (fired.size() == 1) {
+            wheel.schedule(wheel.get_time(), 10);
+            wheel.schedule(wheel.get_time() + 20, 20);
+            cancelled = wheel.schedule(wheel.get_time() + 30, 30);
+        }
+        else if (token == 20) {
+            wheel.cancel(cancelled);
+        }
+    });
+
+    ASSERT_EQ(fired.size(), 5);
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_EQ(fired[i].first, 5);
+    }
+    EXPECT_EQ(fired[3], (pair<ull, ull>(6, 10)));
+    EXPECT_EQ(fired[4], (pair<ull, ull>(25, 20)));
+    EXPECT_EQ(wheel.size(), 0);
+}
+
+TEST(TimerWheelTest, CancelWhileFiringAssertions) {
+    TimerWheel wheel;
+    vector<ull> fired;
+    vector<TimerId> timers;
+    for (ull token = 0; token < 4; token++) {
+        timers.push_back(wheel.schedule(3, token));
+    }
+
+    wheel.advance(3, [&](ull token) {
+        fired.push_back(token);
+        for (auto timer : timers) {
+            wheel.cancel(timer);
+        }
+    });
+
+    EXPECT_EQ(fired.size(), 1);
+    EXPECT_EQ(wheel.size(), 0);
+}
@@ -0,0 +1,54 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "utils/parser/Tokenizer.h"
+
+TEST(TokenizerTest, BufferAssertions) {
+    Tokenizer tokenizer(string_view("2\nROUND 1\n  TAP  A B knife 00:01:000\n"));
+
+    EXPECT_EQ(tokenizer.next_uint(), 2);
+    EXPECT_EQ(tokenizer.next(), "ROUND");
+    EXPECT_EQ(tokenizer.next_uint(), 1);
+    EXPECT_EQ(tokenizer.next(), "TAP");
+    EXPECT_EQ(tokenizer.next(), "A");
+    EXPECT_EQ(tokenizer.next(), "B");
+    EXPECT_EQ(tokenizer.next(), "knife");
+    EXPECT_EQ(tokenizer.next(), "00:01:000");
+    EXPECT_TRUE(tokenizer.next().empty());
+    EXPECT_TRUE(tokenizer.next().empty());
+}
+
+TEST(TokenizerTest, StreamAssertions) {
+    stringstream stream("2\r\n\nROUND 1\nSCORE-BOARD 00:01:000");
+    Tokenizer tokenizer(stream);
+
+    EXPECT_EQ(tokenizer.next_uint(), 2);
+    EXPECT_EQ(tokenizer.next(), "ROUND");
+    EXPECT_EQ(tokenizer.next_uint(), 1);
+    EXPECT_EQ(tokenizer.next(), "SCORE-BOARD");
+    EXPECT_EQ(tokenizer.next(), "00:01:000");
+    EXPECT_TRUE(tokenizer.next().empty());
+}
+
+TEST(TokenizerTest, ResetAssertions) {
+    stringstream stream("first");
+    Tokenizer tokenizer(string_view("buffer"));
+
+    EXPECT_EQ(tokenizer.next(), "buffer");
+
+    tokenizer.reset(stream);
+    EXPECT_EQ(tokenizer.next(), "first");
+    EXPECT_TRUE(tokenizer.next().empty());
+
+    tokenizer.reset(string_view("second"));
+    EXPECT_EQ(tokenizer.next(), "second");
+}
+
+TEST(TokenizerTest, InvalidUintAssertions) {
+    Tokenizer tokenizer(string_view("12a -1"));
+
+    EXPECT_THROW(tokenizer.next_uint(), invalid_argument);
+    EXPECT_THROW(tokenizer.next_uint(), invalid_argument);
+    EXPECT_THROW(tokenizer.next_uint(), invalid_argument);
+}
@@ -0,0 +1,82 @@
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+
+#include "utils/data/Data.h"
+#include "utils/trace/Trace.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+
+TEST(TraceTest, RingBufferAssertions) {
+    EXPECT_THROW(TraceBuffer(0, 1), out_of_range);
+
+    TraceBuffer buffer(3, 7);
+    buffer.record("first", 1, 10);
+    buffer.record("second", 2, 20);
+    EXPECT_EQ(buffer.get_size(), 2);
+    EXPECT_STREQ(buffer.get_event(0).name, "first");
+
+    buffer.record("third", 3, 30);
+    buffer.record("fourth", 4, 40);
+
+    EXPECT_EQ(buffer.get_size(), 3);
+    EXPECT_EQ(buffer.get_capacity(), 3);
+    EXPECT_EQ(buffer.get_thread_id(), 7);
+    EXPECT_STREQ(buffer.get_event(0).name, "second");
+    EXPECT_STREQ(buffer.get_event(2).name, "fourth");
+    EXPECT_EQ(buffer.get_event(2).duration, 40);
+    EXPECT_THROW(buffer.get_event(3), out_of_range);
+
+    buffer.clear();
+    EXPECT_EQ(buffer.get_size(), 0);
+}
+
+TEST(TraceTest, JsonAssertions) {
+    Trace::clear();
+    ull start = Trace::now();
+    Trace::record("main", start);
+    thread([] {
+        TraceSpan span("worker");
+    }).join();
+
+    ostringstream stream;
+    Trace::write_json(stream);
+    auto json = nlohmann::json::parse(stream.str());
+    auto& events = json["traceEvents"];
+
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0]["ph"], "X");
+    EXPECT_NE(events[0]["tid"], events[1]["tid"]);
+    EXPECT_GE(events[0]["ts"].get<double>(), 0);
+    EXPECT_GE(events[1]["dur"].get<double>(), 0);
+    Trace::clear();
+}
+
+TEST(TraceTest, MatchSpansAssertions) {
+    Data::load();
+    string input = "1\n"
+                   "ROUND 3\n"
+                   "ADD-USER Player Terrorist 00:01:000\n"
+                   "ADD-USER Other Counter-Terrorist 00:01:000\n"
+                   "TAP Player Other knife 00:05:000\n";
+    ostringstream output;
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output);
+    interactions.init();
+    interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds()));
+    Trace::clear();
+    interactions.begin();
+
+    ostringstream stream;
+    Trace::write_json(stream);
+    string trace = stream.str();
+    for (const char* name : {"\"TAP\"", "\"parse\"", "\"validate\"", "\"execute\"", "\"respond\"",
+                             "\"determine_winner_and_go_next_round\""}) {
+        EXPECT_EQ(trace.find(name) != string::npos, Trace::is_enabled()) << name;
+    }
+    Trace::clear();
+}
@@ -0,0 +1,42 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "server/WorkStealingPool.h"
+
+TEST(WorkStealingPoolTest, ConstructionOutOfRangeAssertions) {
+    EXPECT_THROW(WorkStealingPool(0), out_of_range);
+}
+
+TEST(WorkStealingPoolTest, RunsEveryTaskOnceAssertions) {
+    const size_t task_count = 1000;
+    vector<atomic<int>> runs(task_count);
+    WorkStealingPool pool(4);
+
+    for (size_t i = 0; i < task_count; i++) {
+        pool.submit([&runs, i] { runs[i]++; });
+    }
+    pool.wait();
+
+    EXPECT_EQ(pool.get_worker_count(), 4);
+    for (size_t i = 0; i < task_count; i++) {
+        EXPECT_EQ(runs[i], 1);
+    }
+}
+
+TEST(WorkStealingPoolTest, WaitsForTasksSubmittedByTasksAssertions) {
+    atomic<int> runs(0);
+    WorkStealingPool pool(2);
+
+    for (int i = 0; i < 10; i++) {
+        pool.submit([&pool, &runs] {
+            runs++;
+            pool.submit([&runs] { runs++; });
+        });
+    }
+    pool.wait();
+
+    EXPECT_EQ(runs, 20);
+}
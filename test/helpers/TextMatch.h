@@ -0,0 +1,50 @@
+#ifndef CSXD_TEXTMATCH_H
+#define CSXD_TEXTMATCH_H
+
+
+#include <unistd.h>
+#include <filesystem>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "utils/matchlog/MatchLogWriter.h"
+#include "GamePlay.h"
+#include "Interactions.h"
+
+using namespace std;
+
+typedef unsigned long long ull;
+
+/// Plays a textual match through Interactions and returns its output. When given, every command is also recorded as a
+/// match log into log_stream, and command_count receives the number of commands played.
+inline string play_text_match(const string& input, ostream* log_stream = nullptr, ull* command_count = nullptr) {
+    ostringstream output;
+    unique_ptr<MatchLogWriter> recorder;
+    Interactions interactions;
+    interactions.set_input_buffer(input);
+    interactions.set_output_stream(output);
+    if (log_stream != nullptr) {
+        recorder = make_unique<MatchLogWriter>(*log_stream);
+        interactions.set_recorder(recorder.get());
+    }
+    interactions.init();
+    interactions.set_game_play(make_shared<GamePlay>(interactions.get_rounds()));
+    interactions.begin();
+    if (recorder != nullptr) {
+        recorder->flush();
+    }
+    if (command_count != nullptr) {
+        *command_count = interactions.get_command_count();
+    }
+    return output.str();
+}
+
+/// A path in the temporary directory that is unique to this test process, since ctest may run tests in parallel
+inline filesystem::path get_temporary_path(const string& name) {
+    return filesystem::temp_directory_path() / (name + "_" + to_string(getpid()));
+}
+
+
+#endif //CSXD_TEXTMATCH_H
@@ -25,10 +25,17 @@ public:
     MOCK_METHOD(void, end, (), (override));
     MOCK_METHOD(bool, has_ended, (), (const, override));
     MOCK_METHOD(vector<shared_ptr<Player>>, get_all_players, (Side side), (const, override));
+    MOCK_METHOD(const pmr::vector<shared_ptr<Player>>&, get_team, (Side side), (const, override));
+    MOCK_METHOD(const pmr::vector<shared_ptr<Player>>&, get_scoreboard, (Side side), (const, override));
     MOCK_METHOD(shared_ptr<Player>, get_player_by_name, (const string& name), (override));
+    MOCK_METHOD(shared_ptr<Player>, find_player_by_name, (const string& name), (override));
+    MOCK_METHOD(shared_ptr<Player>, get_player_by_handle, (PlayerHandle handle), (const, override));
+    MOCK_METHOD(shared_ptr<Player>, find_player_by_handle, (PlayerHandle handle), (const, override));
+    MOCK_METHOD(PlayerHandle, get_player_handle, (const string& name), (const, override));
     MOCK_METHOD(vector<shared_ptr<Player>>, get_alive_players, (Side side), (const, override));
     MOCK_METHOD(uint, get_alive_player_count, (Side side), (const, override));
-    MOCK_METHOD(void, add_player, (const shared_ptr<Player>& player), (override));
+    MOCK_METHOD(PlayerHandle, add_player, (const shared_ptr<Player>& player), (override));
+    MOCK_METHOD(void, reset_players_and_add_money, (Side side, uint money), (override));
 };
 
 
@@ -12,15 +12,25 @@ class MockGamePlay : public GamePlay {
 public:
     MockGamePlay() : GamePlay(1) { }
 
+    using GamePlay::get_hp;
+    using GamePlay::get_money;
+    using GamePlay::buy_weapon;
+    using GamePlay::try_buy_weapon;
+    using GamePlay::attack_occurred;
+    using GamePlay::try_attack_occurred;
+
     MOCK_METHOD(void, set_round_time, (ull time), (const, override));
     MOCK_METHOD(shared_ptr<Player>, create_player, (const string& name, Side side), (const, override));
-    MOCK_METHOD(void, add_player, (const shared_ptr<Player>& player), (const, override));
+    MOCK_METHOD(PlayerHandle, add_player, (const shared_ptr<Player>& player), (const, override));
     MOCK_METHOD(uint, get_hp, (const string& player_name), (const, override));
     MOCK_METHOD(uint, get_money, (const string& player_name), (const, override));
     MOCK_METHOD(void, buy_weapon, (const string& player_name, const shared_ptr<Weapon>& weapon), (const, override));
+    MOCK_METHOD(ActionResult, try_buy_weapon, (const string& player_name, const shared_ptr<Weapon>& weapon), (const, override));
     MOCK_METHOD(void, attack_occurred, (const string& attacker_name, const string& attacked_name, WeaponType weapon_type), (const, override));
+    MOCK_METHOD(ActionResult, try_attack_occurred, (const string& attacker_name, const string& attacked_name, WeaponType weapon_type), (const, override));
     MOCK_METHOD(Side, determine_winner_and_go_next_round, (), (const, override));
     MOCK_METHOD(vector<shared_ptr<Player>>, get_scoreboard, (Side side), (const, override));
+    MOCK_METHOD(const pmr::vector<shared_ptr<Player>>&, get_scoreboard_view, (Side side), (const, override));
     MOCK_METHOD(bool, has_ended, (), (const, override));
 };
 
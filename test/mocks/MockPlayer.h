@@ -10,7 +10,9 @@
 
 class MockPlayer : public Player {
 public:
-    MockPlayer() : Player("", 0, 0, 0, COUNTER_TERRORIST, 0) { }
+    MockPlayer() : Player("", 0, 0, 0, COUNTER_TERRORIST, 0) {
+        ON_CALL(*this, get_name).WillByDefault(::testing::ReturnRef(name));
+    }
 
     MOCK_METHOD(uint, get_hp, (), (const, override));
     MOCK_METHOD(void, add_hp, (uint added_hp), (override));
@@ -24,12 +26,15 @@ public:
     MOCK_METHOD(uint, get_money, (), (const, override));
     MOCK_METHOD(void, add_money, (uint amount), (override));
     MOCK_METHOD(void, subtract_money, (uint amount), (override));
+    MOCK_METHOD(bool, try_subtract_money, (uint amount), (override));
     MOCK_METHOD(ull, get_entry_time, (), (const, override));
     MOCK_METHOD(Side, get_side, (), (const, override));
-    MOCK_METHOD(string, get_name, (), (const, override));
-    MOCK_METHOD(shared_ptr<Weapon>, get_weapon, (WeaponType type), (override));
-    MOCK_METHOD(void, equip_weapon, (shared_ptr<Weapon> weapon), (override));
+    MOCK_METHOD(const string&, get_name, (), (const, override));
+    MOCK_METHOD(const Weapon*, get_weapon, (WeaponType type), (const, override));
+    MOCK_METHOD(const Weapon*, find_weapon, (WeaponType type), (const, override));
+    MOCK_METHOD(void, equip_weapon, (const Weapon* weapon), (override));
     MOCK_METHOD(void, drop_weapon, (WeaponType type), (override));
+    MOCK_METHOD(bool, try_drop_weapon, (WeaponType type), (override));
 };
 
 